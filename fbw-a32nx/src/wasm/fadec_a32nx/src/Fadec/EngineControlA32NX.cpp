@@ -9,6 +9,7 @@
 
 #include "EngineControlA32NX.h"
 #include "EngineRatios.hpp"
+#include "Fadec.h"
 #include "Polynomials_A32NX.hpp"
 #include "Tables1502_A32NX.hpp"
 #include "ThrustLimits_A32NX.hpp"
@@ -939,9 +940,9 @@ void EngineControl_A32NX::updateFuel(double deltaTimeSeconds) {
   }
 
   //--------------------------------------------
-  // Will save the current fuel quantities at a certain interval
-  // if the aircraft is on the ground and the engines are off/shutting down
-  if (msfsHandlerPtr->getSimOnGround() && (msfsHandlerPtr->getSimulationTime() - lastFuelSaveTime) > FUEL_SAVE_INTERVAL &&
+  // Will save the current fuel quantities at a certain interval if they have changed
+  // and the aircraft is on the ground and the engines are off/shutting down
+  if (msfsHandlerPtr->getSimOnGround() &&
       (engine1State == OFF || engine1State == SHUTTING || engine2State == OFF || engine2State == SHUTTING)) {
     fuelConfiguration.setFuelLeft(simData.fuelLeftPre->get() / weightLbsPerGallon);
     fuelConfiguration.setFuelRight(simData.fuelRightPre->get() / weightLbsPerGallon);
@@ -949,8 +950,7 @@ void EngineControl_A32NX::updateFuel(double deltaTimeSeconds) {
     fuelConfiguration.setFuelLeftAux(simData.fuelAuxLeftPre->get() / weightLbsPerGallon);
     fuelConfiguration.setFuelRightAux(simData.fuelAuxRightPre->get() / weightLbsPerGallon);
 
-    fuelConfiguration.saveConfigurationToIni();
-    lastFuelSaveTime = msfsHandlerPtr->getSimulationTime();
+    fuelConfiguration.saveConfigurationToIniIfChanged(msfsHandlerPtr->getSimulationTime());
   }
 
 #ifdef PROFILING
@@ -964,7 +964,7 @@ void EngineControl_A32NX::updateFuel(double deltaTimeSeconds) {
 void EngineControl_A32NX::updateThrustLimits(double                  simulationTime,
                                              double                  pressureAltitude,
                                              double                  ambientTemperature,
-                                             double                  ambientPressure,
+                                             [[maybe_unused]] double ambientPressure,
                                              double                  mach,
                                              [[maybe_unused]] double simN1highest,
                                              int                     packs,
@@ -977,31 +977,19 @@ void EngineControl_A32NX::updateThrustLimits(double                  simulationT
   const double flexTemp      = simData.airlinerToFlexTemp->get();
   const double pressAltitude = simData.simVarsDataPtr->data().pressureAltitude;
 
-  double to      = 0;
-  double ga      = 0;
-  double toga    = 0;
-  double clb     = 0;
-  double mct     = 0;
-  double flex_to = 0;
-  double flex_ga = 0;
-  double flex    = 0;
-
   // Write all N1 Limits
-  to = ThrustLimits_A32NX::limitN1(0, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  ga = ThrustLimits_A32NX::limitN1(1, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  if (flexTemp > 0) {
-    flex_to =
-        ThrustLimits_A32NX::limitN1(0, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
-    flex_ga =
-        ThrustLimits_A32NX::limitN1(1, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
-  }
-  clb = ThrustLimits_A32NX::limitN1(2, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  mct = ThrustLimits_A32NX::limitN1(3, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  const auto   limits  = thrustLimitCache.get(pressAltitude, ambientTemperature, flexTemp, packs, nai, wai);
+  const double to      = limits.to;
+  const double ga      = limits.ga;
+  const double flex_to = limits.flexTo;
+  const double flex_ga = limits.flexGa;
+  double       clb     = limits.clb;
+  double       mct     = limits.mct;
 
   // transition between TO and GA limit -----------------------------------------------------------------------------
-  double machFactorLow = (std::max)(0.0, (std::min)(1.0, (mach - 0.04) / 0.04));
-  toga                 = to + (ga - to) * machFactorLow;
-  flex                 = flex_to + (flex_ga - flex_to) * machFactorLow;
+  const double machFactorLow = (std::max)(0.0, (std::min)(1.0, (mach - 0.04) / 0.04));
+  double       toga          = to + (ga - to) * machFactorLow;
+  const double flex          = flex_to + (flex_ga - flex_to) * machFactorLow;
 
   // adaption of CLB due to FLX limit if necessary ------------------------------------------------------------------
   const double thrustLimitType = simData.thrustLimitType->get();
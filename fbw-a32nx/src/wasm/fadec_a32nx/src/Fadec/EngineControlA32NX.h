@@ -8,6 +8,8 @@
 
 #include "FadecSimData_A32NX.hpp"
 #include "FuelConfiguration_A32NX.h"
+#include "ThrustLimitCache.hpp"
+#include "ThrustLimits_A32NX.hpp"
 
 #define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
 #define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
@@ -39,10 +41,6 @@ class EngineControl_A32NX {
   // Fuel configuration for loading and storing fuel levels
   FuelConfiguration_A32NX fuelConfiguration{};
 
-  // previous time the fuel levels were saved to file
-  double lastFuelSaveTime = 0.0;
-  static constexpr double FUEL_SAVE_INTERVAL = 5.0;  // seconds
-
   // some pump timings - unclear why these are needed
   double pumpStateLeftTimeStamp = 0.0;
   double pumpStateRightTimeStamp = 0.0;
@@ -62,6 +60,9 @@ class EngineControl_A32NX {
   double transitionFactor;
   bool wasFlexActive = false;
 
+  // N1 limits, only recomputed when the altitude/temperature band or the configuration changes
+  ThrustLimitCache<ThrustLimits_A32NX> thrustLimitCache{};
+
   // additional constants
   static constexpr int MAX_OIL = 200;
   static constexpr int MIN_OIL = 140;
@@ -1,6 +1,7 @@
 // Copyright (c) 2023-2024 FlyByWire Simulations
 // SPDX-License-Identifier: GPL-3.0
 
+#include <cmath>
 #include <iostream>
 #include <string>
 
@@ -20,12 +21,14 @@ void FuelConfiguration_A32NX::loadConfigurationFromIni() {
 
   LOG_INFO("Fadec::FuelConfiguration_A32NX: loading configuration file " + configFilename);
 
-  mINI::INIStructure ini;
   mINI::INIFile iniFile(configFilename);
 
   if (!iniFile.read(ini)) {
     LOG_ERROR("Fadec::FuelConfiguration_A32NX: failed to read configuration file \"" + configFilename + "\" due to error \"" +
               strerror(errno) + "\" -> using default fuel quantities.");
+    // the next save must create the file from scratch, whatever the reader left in the structure
+    ini.clear();
+    iniFileExists = false;
     return;
   }
 
@@ -35,6 +38,10 @@ void FuelConfiguration_A32NX::loadConfigurationFromIni() {
   fuelLeftAux = mINI::INITypeConversion::getDouble(ini, INI_SECTION_FUEL, INI_SECTION_FUEL_LEFT_AUX_QUANTITY, fuelLeftAuxDefault);
   fuelRightAux = mINI::INITypeConversion::getDouble(ini, INI_SECTION_FUEL, INI_SECTION_FUEL_RIGHT_AUX_QUANTITY, fuelRightAuxDefault);
 
+  iniFileExists = true;
+  savedQuantities = getQuantities();
+  hasSavedQuantities = true;
+
   LOG_DEBUG("Fadec::FuelConfiguration_A32NX: loaded fuel configuration from " + configFilename + " with the following values:");
   LOG_DEBUG("Fadec::FuelConfiguration_A32NX: " + this->toString());
 }
@@ -42,28 +49,53 @@ void FuelConfiguration_A32NX::loadConfigurationFromIni() {
 void FuelConfiguration_A32NX::saveConfigurationToIni() {
   LOG_DEBUG("Fadec::FuelConfiguration_A32NX: saving configuration file " + configFilename);
 
-  mINI::INIStructure ini;
   mINI::INIFile iniFile(configFilename);
 
-  // Do not check a possible error since the file may not exist yet
-  iniFile.read(ini);
-
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_CENTER_QUANTITY] = std::to_string(this->fuelCenter);
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_LEFT_QUANTITY] = std::to_string(this->fuelLeft);
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_RIGHT_QUANTITY] = std::to_string(this->fuelRight);
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_LEFT_AUX_QUANTITY] = std::to_string(this->fuelLeftAux);
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_RIGHT_AUX_QUANTITY] = std::to_string(this->fuelRightAux);
 
-  if (!iniFile.write(ini, true)) {
+  // Once the file has been read, the in-memory structure holds all of its contents and can simply be written out.
+  // Otherwise the file may not exist yet or still contain other sections, which write() creates or merges.
+  const bool written = iniFileExists ? iniFile.generate(ini, true) : iniFile.write(ini, true);
+  if (!written) {
     LOG_ERROR("Fadec::FuelConfiguration_A32NX: failed to write engine conf " + configFilename + " due to error \"" + strerror(errno) +
               "\"");
     return;
   }
 
+  iniFileExists = true;
+  savedQuantities = getQuantities();
+  hasSavedQuantities = true;
+
   LOG_DEBUG("Fadec::FuelConfiguration_A32NX: saved fuel configuration to " + configFilename + " with the following values:");
   LOG_DEBUG("Fadec::FuelConfiguration_A32NX: " + this->toString());
 }
 
+void FuelConfiguration_A32NX::saveConfigurationToIniIfChanged(double simulationTime) {
+  if (simulationTime - lastSaveTime <= SAVE_INTERVAL || !hasChangedSinceSave()) {
+    return;
+  }
+  // also on failure, to not retry writing the file every frame
+  lastSaveTime = simulationTime;
+  saveConfigurationToIni();
+}
+
+bool FuelConfiguration_A32NX::hasChangedSinceSave() const {
+  if (!hasSavedQuantities) {
+    return true;
+  }
+  const std::array<double, 5> quantities = getQuantities();
+  for (std::size_t i = 0; i < quantities.size(); i++) {
+    if (std::abs(quantities[i] - savedQuantities[i]) > SAVE_THRESHOLD) {
+      return true;
+    }
+  }
+  return false;
+}
+
 std::string FuelConfiguration_A32NX::toString() const {
   std::ostringstream oss;
   oss << "FuelConfiguration_A32NX: { "
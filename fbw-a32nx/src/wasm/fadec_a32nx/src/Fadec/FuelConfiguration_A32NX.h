@@ -4,8 +4,11 @@
 #ifndef FLYBYWIRE_AIRCRAFT_FUELCONFIGURATION_A32NX_H
 #define FLYBYWIRE_AIRCRAFT_FUELCONFIGURATION_A32NX_H
 
+#include <array>
 #include <string>
 
+#include "inih/ini.h"
+
 // Define constants for the INI file sections and keys
 #define INI_SECTION_FUEL "FUEL"
 #define INI_SECTION_FUEL_CENTER_QUANTITY "FUEL_CENTER_QUANTITY"
@@ -20,6 +23,9 @@
  *
  * This class provides methods to load and save the fuel configuration from/to an INI file.
  * It also provides getter and setter methods for each fuel tank quantity.
+ *
+ * The parsed INI file is kept in memory after loading, so saving does not need to read the file again. Periodic saves
+ * should use saveConfigurationToIniIfChanged() which only writes the file if a tank quantity has changed noticeably.
  */
 class FuelConfiguration_A32NX {
  private:
@@ -37,8 +43,33 @@ class FuelConfiguration_A32NX {
   double fuelLeftAux = fuelLeftAuxDefault;
   double fuelRightAux = fuelRightAuxDefault;
 
+  // Minimum change of a tank quantity in gallons before the configuration is saved again
+  static constexpr double SAVE_THRESHOLD = 0.1;
+  // Minimum time between two saves in seconds
+  static constexpr double SAVE_INTERVAL = 5.0;
+
+  // Tank quantities in gallons when the configuration was last loaded or saved, unset until then
+  std::array<double, 5> savedQuantities{};
+  bool hasSavedQuantities = false;
+  double lastSaveTime = 0.0;
+
+  // Contents of the INI file as last loaded or saved
+  mINI::INIStructure ini;
+  bool iniFileExists = false;
+
   std::string configFilename{"A32NX-default-fuel-config.ini"};
 
+  /**
+   * @brief Returns the current tank quantities in gallons in the order of savedQuantities.
+   */
+  std::array<double, 5> getQuantities() const { return {fuelCenter, fuelLeft, fuelRight, fuelLeftAux, fuelRightAux}; }
+
+  /**
+   * @brief Checks if nothing has been loaded or saved yet or any tank quantity differs from the last loaded or saved one
+   * by more than SAVE_THRESHOLD.
+   */
+  bool hasChangedSinceSave() const;
+
  public:
   /**
    * @brief Returns the filename of the INI file to use for loading and saving the fuel configuration.
@@ -71,6 +102,16 @@ class FuelConfiguration_A32NX {
    */
   void saveConfigurationToIni();
 
+  /**
+   * @brief Saves the current fuel configuration to an INI file if it has changed since the last save.
+   *
+   * The file is only written if a tank quantity changed by more than SAVE_THRESHOLD gallons and at least
+   * SAVE_INTERVAL seconds have passed since the last save, so this can be called every frame.
+   *
+   * @param simulationTime The current simulation time in seconds.
+   */
+  void saveConfigurationToIniIfChanged(double simulationTime);
+
   /**
  * @brief Converts the current fuel configuration to a string.
  *
@@ -5,6 +5,8 @@
 #include <cmath>
 #include <numeric>
 
+#include "Horner.hpp"
+
 /**
  * @brief Class representing a collection of multi-variate regression polynomials for engine parameters.
  *
@@ -51,10 +53,7 @@ class Polynomial_A32NX {
     };
 
     // Calculate the N2 percentage using the polynomial equation.
-    double outN2 = 0.0;
-    for (int i = 0; i < 16; ++i) {
-      outN2 += c_N2[i] * (std::pow)(normalN2, i);
-    }
+    double outN2 = Horner::evaluate(c_N2, normalN2);
 
     outN2 *= n2;
     outN2 = (std::max)(outN2, preN2 + 0.002);
@@ -87,15 +86,12 @@ class Polynomial_A32NX {
     };
 
     // Calculate the N1 percentage using the polynomial equation.
-    const double normalN1pre = (-2.4698087 * (std::pow)(normalN2, 3))   //
-                               + (0.9662026 * (std::pow)(normalN2, 2))  //
-                               + (0.0701367 * normalN2);                //
+    const double normalN1pre = (-2.4698087 * normalN2 * normalN2 * normalN2)  //
+                               + (0.9662026 * normalN2 * normalN2)            //
+                               + (0.0701367 * normalN2);                      //
 
     // Calculate the N2 percentage using the polynomial equation.
-    double normalN1post = 0.0;
-    for (int i = 0; i < 9; ++i) {
-      normalN1post += c_N1[i] * (std::pow)(normalN2, i);
-    }
+    double normalN1post = Horner::evaluate(c_N1, normalN2);
 
     // Return the calculated N1 percentage, ensuring it is within the range [normalN1pre, normalN1post]
     // and then multiplied by idleN1.
@@ -131,9 +127,7 @@ class Polynomial_A32NX {
           -4.1220062e+03   // coefficient for x^8
       };
       // Calculate the FF using the polynomial equation.
-      for (int i = 0; i < 9; ++i) {
-        normalFF += c_FF[i] * (std::pow)(normalN2, i);
-      }
+      normalFF = Horner::evaluate(c_FF, normalN2);
     }
 
     // Return the calculated FF, ensuring it is not less than 0.0 and then multiplied by idleFF.
@@ -179,10 +173,7 @@ class Polynomial_A32NX {
       };
 
       // Calculate the EGT using the polynomial equation.
-      normalizedEGT = 0.0;
-      for (int i = 0; i < 9; ++i) {
-        normalizedEGT += c_EGT[i] * (std::pow)(normalizedN2, i);
-      }
+      normalizedEGT = Horner::evaluate(c_EGT, normalizedN2);
     }
 
     // Return the calculated EGT, ensuring it is within the range [ambientTemp, idleEGT].
@@ -291,22 +282,12 @@ class Polynomial_A32NX {
         1.9312e-08    // coefficient for x^15
     };
 
-    return c_EGT[0]                             //
-           + c_EGT[1]                           //
-           + (c_EGT[2] * cn1)                   //
-           + (c_EGT[3] * cff)                   //
-           + (c_EGT[4] * mach)                  //
-           + (c_EGT[5] * alt)                   //
-           + (c_EGT[6] * (std::pow)(cn1, 2))    //
-           + (c_EGT[7] * cn1 * cff)             //
-           + (c_EGT[8] * cn1 * mach)            //
-           + (c_EGT[9] * cn1 * alt)             //
-           + (c_EGT[10] * (std::pow)(cff, 2))   //
-           + (c_EGT[11] * mach * cff)           //
-           + (c_EGT[12] * cff * alt)            //
-           + (c_EGT[13] * (std::pow)(mach, 2))  //
-           + (c_EGT[14] * mach * alt)           //
-           + (c_EGT[15] * (std::pow)(alt, 2));
+    // Calculate and return the Corrected EGT value using a polynomial model, with the terms grouped by variable
+    return c_EGT[0] + c_EGT[1]                                                                              //
+           + cn1 * (c_EGT[2] + (c_EGT[6] * cn1) + (c_EGT[7] * cff) + (c_EGT[8] * mach) + (c_EGT[9] * alt))  //
+           + cff * (c_EGT[3] + (c_EGT[10] * cff) + (c_EGT[11] * mach) + (c_EGT[12] * alt))                  //
+           + mach * (c_EGT[4] + (c_EGT[13] * mach) + (c_EGT[14] * alt))                                     //
+           + alt * (c_EGT[5] + (c_EGT[15] * alt));
   }
 
   /**
@@ -343,27 +324,16 @@ class Polynomial_A32NX {
         1.2728e-11    // coefficient for x^20
     };
 
-    return c_Flow[0]                                   //
-           + c_Flow[1]                                 //
-           + (c_Flow[2] * cn1)                         //
-           + (c_Flow[3] * mach)                        //
-           + (c_Flow[4] * alt)                         //
-           + (c_Flow[5] * (std::pow)(cn1, 2))          //
-           + (c_Flow[6] * cn1 * mach)                  //
-           + (c_Flow[7] * cn1 * alt)                   //
-           + (c_Flow[8] * (std::pow)(mach, 2))         //
-           + (c_Flow[9] * mach * alt)                  //
-           + (c_Flow[10] * (std::pow)(alt, 2))         //
-           + (c_Flow[11] * (std::pow)(cn1, 3))         //
-           + (c_Flow[12] * (std::pow)(cn1, 2) * mach)  //
-           + (c_Flow[13] * (std::pow)(cn1, 2) * alt)   //
-           + (c_Flow[14] * cn1 * (std::pow)(mach, 2))  //
-           + (c_Flow[15] * cn1 * mach * alt)           //
-           + (c_Flow[16] * cn1 * (std::pow)(alt, 2))   //
-           + (c_Flow[17] * (std::pow)(mach, 3))        //
-           + (c_Flow[18] * (std::pow)(mach, 2) * alt)  //
-           + (c_Flow[19] * mach * (std::pow)(alt, 2))  //
-           + (c_Flow[20] * (std::pow)(alt, 3));
+    // Calculate the Corrected Fuel Flow value using a polynomial model, with the terms grouped by variable
+    return c_Flow[0] + c_Flow[1]                                                                         //
+           + cn1 * (c_Flow[2]                                                                            //
+                    + cn1 * (c_Flow[5] + (c_Flow[11] * cn1) + (c_Flow[12] * mach) + (c_Flow[13] * alt))  //
+                    + mach * (c_Flow[6] + (c_Flow[14] * mach) + (c_Flow[15] * alt))                      //
+                    + alt * (c_Flow[7] + (c_Flow[16] * alt)))                                            //
+           + mach * (c_Flow[3]                                                                           //
+                     + mach * (c_Flow[8] + (c_Flow[17] * mach) + (c_Flow[18] * alt))                     //
+                     + alt * (c_Flow[9] + (c_Flow[19] * alt)))                                           //
+           + alt * (c_Flow[4] + alt * (c_Flow[10] + (c_Flow[20] * alt)));
   }
 
   /**
@@ -409,7 +379,7 @@ class Polynomial_A32NX {
   static double oilGulpPct(double thrust) {
     const double oilGulpCoefficients[3] = {20.1968848, -1.2270302e-4, 1.78442e-8};
     const double outOilGulpPct =
-        oilGulpCoefficients[0] + (oilGulpCoefficients[1] * thrust) + (oilGulpCoefficients[2] * (std::pow)(thrust, 2));
+        oilGulpCoefficients[0] + (oilGulpCoefficients[1] * thrust) + (oilGulpCoefficients[2] * thrust * thrust);
     return outOilGulpPct / 100;
   }
 
@@ -421,7 +391,7 @@ class Polynomial_A32NX {
    */
   static double oilPressure(double simN2) {
     const double oilPressureCoefficients[3] = {-0.88921, 0.23711, 0.00682};
-    return oilPressureCoefficients[0] + (oilPressureCoefficients[1] * simN2) + (oilPressureCoefficients[2] * (std::pow)(simN2, 2));
+    return oilPressureCoefficients[0] + (oilPressureCoefficients[1] * simN2) + (oilPressureCoefficients[2] * simN2 * simN2);
   }
 };
 
@@ -6,7 +6,8 @@
 
 #include <cmath>
 
-#include "Fadec.h"
+#include "FadecMath.hpp"
+#include "GridLookupTable.hpp"
 
 /**
  * @class Table1502_A32NX
@@ -45,7 +46,12 @@ class Tables1502_A32NX {
       {116.50, 101.00, 101.00, 101.00}  // CN2 = 116.50, correctedN1 = [101.00, 101.00] at Mach 0.2, correctedN1 = 101.00 at Mach 0.9
   };
 
-  public:
+  /**
+   * @brief Table 1502 with precomputed slopes and a uniform index grid over the CN2 values.
+   */
+  static constexpr GridLookupTable<13, 4> table1502Grid{table1502};
+
+ public:
 
   /**
    * @brief Calculates the expected CN2 at idle.
@@ -57,7 +63,7 @@ class Tables1502_A32NX {
   static double iCN2(double pressureAltitude, double mach) {
     // The specific values are likely derived from empirical data or a mathematical model of the engine's behavior.
     // The original source code does not provide any information on the origin of these values.
-    return 68.2 / ((std::sqrt)((288.15 - (1.98 * pressureAltitude / 1000)) / 288.15) * (std::sqrt)(1 + (0.2 * (std::pow)(mach, 2))));
+    return 68.2 / (std::sqrt)(((288.15 - (1.98 * pressureAltitude / 1000)) / 288.15) * (1 + (0.2 * mach * mach)));
   }
 
   /**
@@ -72,25 +78,11 @@ class Tables1502_A32NX {
     // Calculate the expected CN2 value
     const double cn2 = iCN2(pressureAltitude, mach);
 
-    // Find the row in the table that contains the CN2 value and store the index in i
-    int i = 0;
-    while (table1502[i][0] <= cn2 && i < 13) {
-      i++;
-    }
-
-    // Retrieve the lower and upper bounds of the CN2 value and the correctedN1 value at Mach 0.2 and Mach 0.9
-    const double cn2lo = table1502[i - 1][0];
-    const double cn2hi = table1502[i][0];
-    const double cn1lolo = table1502[i - 1][1];
-    const double cn1hilo = table1502[i][1];
-    const double cn1lohi = table1502[i - 1][3];
-    const double cn1hihi = table1502[i][3];
-
-    // Interpolate the correctedN1 value based on the CN2 value and the Mach number
-    const double cn1_lo = Fadec::interpolate(cn2, cn2lo, cn2hi, cn1lolo, cn1hilo);
-    const double cn1_hi = Fadec::interpolate(cn2, cn2lo, cn2hi, cn1lohi, cn1hihi);
+    // Interpolate the correctedN1 value at Mach 0.2 and Mach 0.9 based on the CN2 value
+    const auto row = table1502Grid.row(cn2);
 
-    return Fadec::interpolate(mach, 0.2, 0.9, cn1_lo, cn1_hi);
+    // Interpolate the correctedN1 value based on the Mach number
+    return FadecMath::interpolate(mach, 0.2, 0.9, row[1], row[3]);
   }
 };
 
@@ -5,10 +5,12 @@
 #define FLYBYWIRE_AIRCRAFT_THRUSTLIMITS_A32NX_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "EngineRatios.hpp"
-#include "Fadec.h"
+#include "FadecMath.hpp"
+#include "GridLookupTable.hpp"
 
 /**
  * @class ThrustLimits_A32NX
@@ -112,20 +114,13 @@ class ThrustLimits_A32NX {
       {39000, -47.286, -18.508, 97.278, 85.545, 0.000}   // row 71
   };
 
- public:
   /**
-   * @brief Finds the top-row boundary in the limits array.
-   *
-   * @param altitude The altitude to find the top-row boundary for.
-   * @param index The index to start the search from.
-   * @return The index of the top-row boundary in the limits array.
+   * @brief The sections of the limits array with precomputed slopes and a uniform index grid over the altitude.
    */
-  static int finder(double altitude, int index) {
-    while (altitude >= limits[index][0]) {
-      index++;
-    }
-    return index;
-  }
+  static constexpr GridLookupTable<21, 6> takeoffLimits{limits, 0};
+  static constexpr GridLookupTable<21, 6> goAroundLimits{limits, 21};
+  static constexpr GridLookupTable<17, 6> climbLimits{limits, 42};
+  static constexpr GridLookupTable<13, 6> maximumContinuousLimits{limits, 59};
 
   /**
    * @brief Structure to store the bleed values for different types of limits.
@@ -144,15 +139,38 @@ class ThrustLimits_A32NX {
   /**
    * @brief Lookup table for bleed values based on limit type.
    *
-   * This map stores the bleed values for different types of limits. The key is an integer
-   * representing the type of limit (0-TO, 1-GA, 2-CLB, 3-MCT),
-   * and the value is a `BleedValues` structure containing the values for `n1Packs`, `n1Nai`, and `n1Wai`.
+   * The table is indexed by the type of limit (0-TO, 1-GA, 2-CLB, 3-MCT), whether the altitude is less than 8000 ft
+   * and whether the outside air temperature is less than the corner point. CLB and MCT have no bleed correction below
+   * the corner point.
    */
-  static std::map<int, BleedValues> bleedValuesLookup;  // see below for initialization
+  static constexpr BleedValues bleedValuesLookup[4][2][2] = {
+      // TO
+      {{{-0.7, -0.8, -0.8}, {-0.6, -0.8, -0.8}},   // altitude >= 8000
+       {{-0.5, -0.6, -0.7}, {-0.4, -0.6, -0.7}}},  // altitude < 8000
+      // GA
+      {{{-0.6, -0.7, -0.8}, {-0.6, -0.7, -0.8}},   // altitude >= 8000
+       {{-0.4, -0.6, -0.6}, {-0.4, -0.6, -0.6}}},  // altitude < 8000
+      // CLB
+      {{{-0.3, -0.8, -0.4}, {0.0, 0.0, 0.0}},      // altitude >= 8000
+       {{-0.2, -0.8, -0.4}, {0.0, 0.0, 0.0}}},     // altitude < 8000
+      // MCT
+      {{{-0.6, -0.9, -1.2}, {0.0, 0.0, 0.0}},      // altitude >= 8000
+       {{-0.6, -0.9, -1.2}, {0.0, 0.0, 0.0}}}      // altitude < 8000
+  };
+
+ public:
+  /**
+   * @brief The altitude in feet above which the CLB limit is based on 300 kt instead of 250 kt.
+   */
+  static constexpr double CLIMB_SPEED_CHANGE_ALTITUDE = 10000;
 
   /**
    * @brief Calculates the total bleed for the engine.
    *
+   * The flex bleed only applies to flex temperatures above the limit point. Where the limit point is constant between
+   * two rows of the thrust limit table it is exactly the tabulated value, so a flex temperature equal to it uses the
+   * normal bleed.
+   *
    * @param type The type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
    * @param altitude The current altitude of the aircraft in feet.
    * @param oat The outside air temperature in degrees Celsius.
@@ -178,120 +196,84 @@ class ThrustLimits_A32NX {
       return packs * -0.6 + nacelle * -0.7 + wing * -0.7;
     }
 
-    // Define a map to store the bleed values for different conditions
-    // Keys:
-    // int - Represents the type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
-    // bool - Represents whether the altitude is less than 8000.
-    // bool - Represents whether the outside air temperature is less than the corner point.
-    // Values:
-    // double - Represents the bleed value for the packs.
-    // double - Represents the bleed value for the nacelle anti-ice.
-    // double - Represents the bleed value for the wing anti-ice.
-    std::map<std::tuple<int, bool, bool>, std::tuple<double, double, double>> bleedValues = {
-        {{0, true, true}, {-0.4, -0.6, -0.7}},    //
-        {{0, true, false}, {-0.5, -0.6, -0.7}},   //
-        {{0, false, true}, {-0.6, -0.8, -0.8}},   //
-        {{0, false, false}, {-0.7, -0.8, -0.8}},  //
-        {{1, true, true}, {-0.4, -0.6, -0.6}},    //
-        {{1, true, false}, {-0.4, -0.6, -0.6}},   //
-        {{1, false, true}, {-0.6, -0.7, -0.8}},   //
-        {{1, false, false}, {-0.6, -0.7, -0.8}},  //
-        {{2, true, false}, {-0.2, -0.8, -0.4}},   //
-        {{2, false, false}, {-0.3, -0.8, -0.4}},  //
-        {{3, true, false}, {-0.6, -0.9, -1.2}},   //
-        {{3, false, false}, {-0.6, -0.9, -1.2}}   //
-    };
-
-    double n1Packs = 0;
-    double n1Nai = 0;
-    double n1Wai = 0;
+    if (type < 0 || type > 3) {
+      return 0;
+    }
 
-    // Use the map to get the bleed values
-    std::tie(n1Packs, n1Nai, n1Wai) = bleedValues[{type, altitude < 8000, oat < cp}];
+    const BleedValues& bleed = bleedValuesLookup[type][altitude < 8000][oat < cp];
+    return packs * bleed.n1Packs + nacelle * bleed.n1Nai + wing * bleed.n1Wai;
+  }
 
-    return packs * n1Packs + nacelle * n1Nai + wing * n1Wai;
+  /**
+   * @brief Returns the row of the thrust limit table for the given type of limit, interpolated at the altitude.
+   *
+   * @param type The type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param altitude The current altitude of the aircraft in feet.
+   * @return The altitude, CP, LP, CN1 flat, CN1 last and CN1 flex, all zero for an unknown type.
+   */
+  static std::array<double, 6> limitRow(int type, double altitude) {
+    switch (type) {
+      case 0: // TO
+        return takeoffLimits.row(altitude);
+      case 1: // GA
+        return goAroundLimits.row(altitude);
+      case 2: // CLB
+        return climbLimits.row(altitude);
+      case 3: // MCT
+        return maximumContinuousLimits.row(altitude);
+      default:
+        return {};
+    }
   }
 
   /**
-   * @brief Calculates the N1 limit for the engine.
+   * @brief Calculates the N1 limit for the engine without the bleed correction.
    *
-   * This function calculates the N1 limit for the engine based on various parameters such as the
-   * type of operation, altitude, ambient temperature, ambient pressure, flex temperature, and the
-   * status of the air conditioning (AC), nacelle anti-ice (nacelle), and wing anti-ice (wing).
+   * Unlike the bleed correction this part of the limit has no steps in the ambient temperature, and the only step in
+   * the altitude is the CLB speed change at CLIMB_SPEED_CHANGE_ALTITUDE.
    *
    * @param type The type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
-   * @param altitude The current altitude of the aircraft.
-   * @param ambientTemp The ambient temperature.
-   * @param ambientPressure The ambient pressure.
-   * @param flexTemp The flex temperature.
-   * @param packs The status of the air conditioning (0 for off, 1 for on).
-   * @param nacelle The status of the nacelle anti-ice (0 for off, 1 for on).
-   * @param wing The status of the wing anti-ice (0 for off, 1 for on).
-   * @return The N1 limit for the engine.
+   * @param row The row of the thrust limit table at the altitude, see limitRow().
+   * @param altitude The current altitude of the aircraft in feet.
+   * @param ambientTemp The ambient temperature in degrees Celsius.
+   * @param ambientPressure The ambient pressure in hPa.
+   * @param flexTemp The flex temperature in degrees Celsius.
+   * @return The N1 limit for the engine without the bleed correction.
    */
-  static double limitN1(int type,                //
-                        double altitude,         //
-                        double ambientTemp,      //
-                        double ambientPressure,  //
-                        double flexTemp,         //
-                        int packs,               //
-                        int nacelle,             //
-                        int wing                 //
+  static double limitN1WithoutBleed(int type,                          //
+                                    const std::array<double, 6>& row,  //
+                                    double altitude,                   //
+                                    double ambientTemp,                //
+                                    double ambientPressure,            //
+                                    double flexTemp                    //
   ) {
-    int rowMin = 0;
-    int rowMax = 0;
-    int loAltRow = 0;
-    int hiAltRow = 0;
     double mach = 0;
 
-    // Set main variables per Limit Type
+    // Set the Mach number per Limit Type
     switch (type) {
-      case 0: // TO
-        rowMin = 0;
-        rowMax = 20;
-        mach = 0;
-        break;
       case 1: // GA
-        rowMin = 21;
-        rowMax = 41;
         mach = 0.225;
         break;
       case 2: // CLB
-        rowMin = 42;
-        rowMax = 58;
-        if (altitude <= 10000) {
-          mach = Fadec::cas2mach(250, ambientPressure);
+        if (altitude <= CLIMB_SPEED_CHANGE_ALTITUDE) {
+          mach = FadecMath::cas2mach(250, ambientPressure);
         } else {
-          mach = Fadec::cas2mach(300, ambientPressure);
+          mach = FadecMath::cas2mach(300, ambientPressure);
           if (mach > 0.78)
             mach = 0.78;
         }
         break;
       case 3: // MCT
-        rowMin = 59;
-        rowMax = 71;
-        mach = Fadec::cas2mach(230, ambientPressure);
+        mach = FadecMath::cas2mach(230, ambientPressure);
         break;
     }
 
-    // Check for over/under flows. Else, find top row value
-    if (altitude <= limits[rowMin][0]) {
-      hiAltRow = rowMin;
-      loAltRow = rowMin;
-    } else if (altitude >= limits[rowMax][0]) {
-      hiAltRow = rowMax;
-      loAltRow = rowMax;
-    } else {
-      hiAltRow = finder(altitude, rowMin);
-      loAltRow = hiAltRow - 1;
-    }
-
     // Define key table variables and interpolation
-    const double cp = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][1], limits[hiAltRow][1]);
-    const double lp = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][2], limits[hiAltRow][2]);
-    const double cn1Flat = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][3], limits[hiAltRow][3]);
-    const double cn1Last = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][4], limits[hiAltRow][4]);
-    const double cn1Flex = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][5], limits[hiAltRow][5]);
+    const double cp = row[1];
+    const double lp = row[2];
+    const double cn1Flat = row[3];
+    const double cn1Last = row[4];
+    const double cn1Flex = row[5];
 
     double cn1 = 0;
     double m = 0;
@@ -319,10 +301,38 @@ class ThrustLimits_A32NX {
       }
     }
 
-    // Define bleed rating/ de-rating
-    const double bleed = bleedTotal(type, altitude, ambientTemp, cp, lp, flexTemp, packs, nacelle, wing);
+    return cn1 * (std::sqrt)(EngineRatios::theta2(mach, ambientTemp));
+  }
 
-    return (cn1 * (std::sqrt)(EngineRatios::theta2(mach, ambientTemp))) + bleed;
+  /**
+   * @brief Calculates the N1 limit for the engine.
+   *
+   * This function calculates the N1 limit for the engine based on various parameters such as the
+   * type of operation, altitude, ambient temperature, ambient pressure, flex temperature, and the
+   * status of the air conditioning (AC), nacelle anti-ice (nacelle), and wing anti-ice (wing).
+   *
+   * @param type The type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param altitude The current altitude of the aircraft.
+   * @param ambientTemp The ambient temperature.
+   * @param ambientPressure The ambient pressure.
+   * @param flexTemp The flex temperature.
+   * @param packs The status of the air conditioning (0 for off, 1 for on).
+   * @param nacelle The status of the nacelle anti-ice (0 for off, 1 for on).
+   * @param wing The status of the wing anti-ice (0 for off, 1 for on).
+   * @return The N1 limit for the engine.
+   */
+  static double limitN1(int type,                //
+                        double altitude,         //
+                        double ambientTemp,      //
+                        double ambientPressure,  //
+                        double flexTemp,         //
+                        int packs,               //
+                        int nacelle,             //
+                        int wing                 //
+  ) {
+    const std::array<double, 6> row = limitRow(type, altitude);
+    return limitN1WithoutBleed(type, row, altitude, ambientTemp, ambientPressure, flexTemp) +
+           bleedTotal(type, altitude, ambientTemp, row[1], row[2], flexTemp, packs, nacelle, wing);
   }
 };
 
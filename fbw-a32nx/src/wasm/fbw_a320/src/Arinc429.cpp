@@ -1,14 +1,12 @@
 #include "Arinc429.h"
+#include "Arinc429Codec.h"
 
 template <typename T>
 Arinc429Word<T>::Arinc429Word() {}
 
 template <typename T>
 void Arinc429Word<T>::setFromSimVar(double simVar) {
-  const auto u64Val = static_cast<uint64_t>(simVar);
-  const uint32_t u32Val = u64Val & 0xffffffff;
-  rawSsm = u64Val >> 32;
-  rawData = *reinterpret_cast<const T*>(&u32Val);
+  Arinc429Codec::decodeWords(&simVar, this, 1);
 }
 template void Arinc429Word<uint32_t>::setFromSimVar(double simVar);
 template void Arinc429Word<float>::setFromSimVar(double simVar);
@@ -23,8 +21,7 @@ template void Arinc429Word<float>::setFromData(float data, Arinc429SignStatus ss
 
 template <typename T>
 double Arinc429Word<T>::toSimVar() {
-  const uint64_t u64Val = *reinterpret_cast<const uint32_t*>(&rawData) | static_cast<uint64_t>(rawSsm) << 32;
-  return static_cast<double>(u64Val);
+  return Arinc429Codec::toSimVar(*this);
 }
 template double Arinc429Word<uint32_t>::toSimVar();
 template double Arinc429Word<float>::toSimVar();
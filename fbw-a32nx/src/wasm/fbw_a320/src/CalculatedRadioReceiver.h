@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Geodesy.h"
+
 struct RadioReceiverResult {
   bool isValid;
   double distance;
@@ -32,12 +34,13 @@ class RadioReceiver {
                                                    double aircraft_position_alt);
 
  private:
-  static constexpr double EARTH_RADIUS_METER = 6371e3;
-
   double cached_gs_deg;
 
+  Geodesy::Position aircraftPosition;
+  Geodesy::Position localizerPosition;
+  Geodesy::Position glideSlopePosition;
+
   double headingNormalize(double u);
   double headingDifference(double u1, double u2);
-  double deg2rad(double degrees);
   double rad2deg(double radians);
 };
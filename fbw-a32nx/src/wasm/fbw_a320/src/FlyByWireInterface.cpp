@@ -1,5 +1,6 @@
 #include <ini.h>
 #include <ini_type_conversion.h>
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -92,25 +93,38 @@ bool FlyByWireInterface::update(double sampleTime) {
   // do not process laws in pause or slew
   if (simData.slew_on) {
     wasInSlew = true;
+    resetModelRateGroups();
     return result;
   } else if (pauseDetected || simData.cameraState >= 10.0 || !idIsReady->get() || simData.simulationTime < 2) {
+    resetModelRateGroups();
     return result;
   }
 
   // update altimeter setting
   result &= updateAltimeterSetting(calculatedSampleTime);
 
-  // update autopilot state machine
-  result &= updateAutopilotStateMachine(calculatedSampleTime);
+  // autopilot and autothrust run at their configured rate and hold their outputs in between, the FCU inputs are
+  // kept until the autopilot has been stepped and only seen by its first step
+  int autopilotSteps = autopilotRateGroup.update(calculatedSampleTime);
+  double autopilotSampleTime = autopilotRateGroup.getStepTime();
 
-  // update autopilot laws
-  result &= updateAutopilotLaws(calculatedSampleTime);
+  for (int step = 0; step < autopilotSteps; step++) {
+    // update autopilot state machine
+    result &= updateAutopilotStateMachine(autopilotSampleTime);
+
+    // update autopilot laws
+    result &= updateAutopilotLaws(autopilotSampleTime);
+
+    simConnectInterface.resetSimInputAutopilot();
+  }
 
   // update fly-by-wire
   result &= updateFlyByWire(calculatedSampleTime);
 
-  // get throttle data and process it
-  result &= updateAutothrust(calculatedSampleTime);
+  for (int step = 0; step < autopilotSteps; step++) {
+    // get throttle data and process it
+    result &= updateAutothrust(autopilotSampleTime);
+  }
 
   for (int i = 0; i < 2; i++) {
     result &= updateRa(i);
@@ -128,20 +142,35 @@ bool FlyByWireInterface::update(double sampleTime) {
     result &= updateAdirs(i);
   }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateElac(calculatedSampleTime, i);
-  }
+  // flight control computers run at their configured rate, the surface commands are interpolated between the outputs
+  // of the last two steps, the rudder trim inputs are held until a frame in which the computers are stepped
+  int flightControlsSteps = flightControlsRateGroup.update(calculatedSampleTime);
+  double flightControlsSampleTime = flightControlsRateGroup.getStepTime();
 
-  for (int i = 0; i < 3; i++) {
-    result &= updateSec(calculatedSampleTime, i);
-  }
+  for (int step = 0; step < flightControlsSteps; step++) {
+    std::copy(std::begin(elacsAnalogOutputs), std::end(elacsAnalogOutputs), std::begin(elacsAnalogOutputsPrevious));
+    std::copy(std::begin(secsAnalogOutputs), std::end(secsAnalogOutputs), std::begin(secsAnalogOutputsPrevious));
+    std::copy(std::begin(facsAnalogOutputs), std::end(facsAnalogOutputs), std::begin(facsAnalogOutputsPrevious));
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateFac(calculatedSampleTime, i);
+    for (int i = 0; i < 2; i++) {
+      result &= updateElac(flightControlsSampleTime, i);
+    }
+
+    for (int i = 0; i < 3; i++) {
+      result &= updateSec(flightControlsSampleTime, i);
+    }
+
+    for (int i = 0; i < 2; i++) {
+      result &= updateFac(flightControlsSampleTime, i);
+    }
+
+    for (int i = 0; i < 2; i++) {
+      result &= updateFcdc(flightControlsSampleTime, i);
+    }
   }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateFcdc(calculatedSampleTime, i);
+  if (flightControlsSteps > 0) {
+    simConnectInterface.resetSimInputRudderTrim();
   }
 
   result &= updateServoSolenoidStatus();
@@ -192,6 +221,10 @@ void FlyByWireInterface::loadConfiguration() {
   secDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "SEC_DISABLED", -1);
   facDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "FAC_DISABLED", -1);
   tailstrikeProtectionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "TAILSTRIKE_PROTECTION_ENABLED", false);
+  autopilotRate = INITypeConversion::getDouble(iniStructure, "MODEL", "AUTOPILOT_RATE", 0);
+  flightControlsRate = INITypeConversion::getDouble(iniStructure, "MODEL", "FLIGHT_CONTROLS_RATE", 0);
+  autopilotRateGroup.setRate(autopilotRate);
+  flightControlsRateGroup.setRate(flightControlsRate);
 
   // if any model is deactivated we need to enable client data
   clientDataEnabled = (elacDisabled != -1 || secDisabled != -1 || facDisabled != -1 || !autopilotStateMachineEnabled ||
@@ -207,6 +240,8 @@ void FlyByWireInterface::loadConfiguration() {
   std::cout << "WASM: MODEL     : SEC_DISABLED                         = " << secDisabled << std::endl;
   std::cout << "WASM: MODEL     : FAC_DISABLED                         = " << facDisabled << std::endl;
   std::cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED        = " << tailstrikeProtectionEnabled << std::endl;
+  std::cout << "WASM: MODEL     : AUTOPILOT_RATE                       = " << autopilotRate << std::endl;
+  std::cout << "WASM: MODEL     : FLIGHT_CONTROLS_RATE                 = " << flightControlsRate << std::endl;
 
   // --------------------------------------------------------------------------
   // load values - autopilot
@@ -268,15 +303,6 @@ void FlyByWireInterface::loadConfiguration() {
     // store axis
     throttleAxis.emplace_back(axis);
   }
-
-  // create mapping for 3D animation position
-  std::vector<std::pair<double, double>> mappingTable3d;
-  mappingTable3d.emplace_back(-20.0, 0.0);
-  mappingTable3d.emplace_back(0.0, 25.0);
-  mappingTable3d.emplace_back(25.0, 50.0);
-  mappingTable3d.emplace_back(35.0, 75.0);
-  mappingTable3d.emplace_back(45.0, 100.0);
-  idThrottlePositionLookupTable3d.initialize(mappingTable3d, 0, 100);
 }
 
 void FlyByWireInterface::setupLocalVariables() {
@@ -596,6 +622,16 @@ void FlyByWireInterface::setupLocalVariables() {
     idFcdcSpoilerRight4Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_4_POS");
     idFcdcSpoilerRight5Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_5_POS");
 
+    LocalVariable* busVariables[] = {idFcdcDiscreteWord1[i].get(), idFcdcDiscreteWord2[i].get(), idFcdcDiscreteWord3[i].get(),
+        idFcdcDiscreteWord4[i].get(), idFcdcDiscreteWord5[i].get(), idFcdcCaptRollCommand[i].get(), idFcdcFoRollCommand[i].get(),
+        idFcdcRudderPedalPos[i].get(), idFcdcCaptPitchCommand[i].get(), idFcdcFoPitchCommand[i].get(), idFcdcAileronLeftPos[i].get(),
+        idFcdcElevatorLeftPos[i].get(), idFcdcAileronRightPos[i].get(), idFcdcElevatorRightPos[i].get(), idFcdcElevatorTrimPos[i].get(),
+        idFcdcSpoilerLeft1Pos[i].get(), idFcdcSpoilerLeft2Pos[i].get(), idFcdcSpoilerLeft3Pos[i].get(), idFcdcSpoilerLeft4Pos[i].get(),
+        idFcdcSpoilerLeft5Pos[i].get(), idFcdcSpoilerRight1Pos[i].get(), idFcdcSpoilerRight2Pos[i].get(), idFcdcSpoilerRight3Pos[i].get(),
+        idFcdcSpoilerRight4Pos[i].get(), idFcdcSpoilerRight5Pos[i].get()};
+    static_assert(std::size(busVariables) == Arinc429Codec::wordCount<base_fcdc_bus>());
+    std::copy(std::begin(busVariables), std::end(busVariables), fcdcBusVariables[i]);
+
     idFcdcPriorityCaptGreen[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_GREEN_ON");
     idFcdcPriorityCaptRed[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_RED_ON");
     idFcdcPriorityFoGreen[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_FO_GREEN_ON");
@@ -800,11 +836,6 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   // set sample time
   simConnectInterface.setSampleTime(sampleTime);
 
-  // reset input
-  simConnectInterface.resetSimInputAutopilot();
-
-  simConnectInterface.resetSimInputRudderTrim();
-
   // set logging options
   simConnectInterface.setLoggingFlightControlsEnabled(idLoggingFlightControlsEnabled->get() == 1);
   simConnectInterface.setLoggingThrottlesEnabled(idLoggingThrottlesEnabled->get() == 1);
@@ -1246,93 +1277,14 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
   SimData simData = simConnectInterface.getSimData();
   SimInput simInput = simConnectInterface.getSimInput();
 
-  elacs[elacIndex].modelInputs.in.time.dt = sampleTime;
-  elacs[elacIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
-  elacs[elacIndex].modelInputs.in.time.monotonic_time = monotonicTime;
-
-  elacs[elacIndex].modelInputs.in.sim_data.slew_on = wasInSlew;
-  elacs[elacIndex].modelInputs.in.sim_data.pause_on = pauseDetected;
-  elacs[elacIndex].modelInputs.in.sim_data.tracking_mode_on_override = idExternalOverride->get() == 1;
-  elacs[elacIndex].modelInputs.in.sim_data.tailstrike_protection_on = tailstrikeProtectionEnabled;
-
-  elacs[elacIndex].modelInputs.in.discrete_inputs.ground_spoilers_active_1 = secsDiscreteOutputs[0].ground_spoiler_out;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.ground_spoilers_active_2 =
-      elacIndex == 0 ? secsDiscreteOutputs[1].ground_spoiler_out : secsDiscreteOutputs[2].ground_spoiler_out;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.is_unit_1 = elacIndex == 0;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.is_unit_2 = elacIndex == 1;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.opp_axis_pitch_failure = !elacsDiscreteOutputs[oppElacIndex].pitch_axis_ok;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.ap_1_disengaged = !autopilotStateMachineOutput.enabled_AP1;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.ap_2_disengaged = !autopilotStateMachineOutput.enabled_AP2;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.opp_left_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].left_aileron_ok;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.opp_right_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].right_aileron_ok;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.fac_1_yaw_control_lost = !facsDiscreteOutputs[0].yaw_damper_avail_for_norm_law;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_nose_gear_pressed = idLgciuNoseGearCompressed[0]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_nose_gear_pressed = idLgciuNoseGearCompressed[1]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.fac_2_yaw_control_lost = !facsDiscreteOutputs[1].yaw_damper_avail_for_norm_law;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_right_main_gear_pressed = idLgciuRightMainGearCompressed[0]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_right_main_gear_pressed = idLgciuRightMainGearCompressed[1]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_left_main_gear_pressed = idLgciuLeftMainGearCompressed[0]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_left_main_gear_pressed = idLgciuLeftMainGearCompressed[1]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.ths_motor_fault = false;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.sfcc_1_slats_out = false;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.sfcc_2_slats_out = false;
-  elacs[elacIndex].modelInputs.in.discrete_inputs.l_ail_servo_failed = idAilFaultLeft[elacIndex]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.l_elev_servo_failed = idElevFaultLeft[elacIndex]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.r_ail_servo_failed = idAilFaultRight[elacIndex]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.r_elev_servo_failed = idElevFaultRight[elacIndex]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.ths_override_active = idThsOverrideActive->get();
+  // The inputs used by the computer monitoring are always required.
   elacs[elacIndex].modelInputs.in.discrete_inputs.yellow_low_pressure = !idHydYellowPressurised->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.capt_priority_takeover_pressed = idCaptPriorityButtonPressed->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.fo_priority_takeover_pressed = idFoPriorityButtonPressed->get();
   elacs[elacIndex].modelInputs.in.discrete_inputs.blue_low_pressure = !idHydBluePressurised->get();
   elacs[elacIndex].modelInputs.in.discrete_inputs.green_low_pressure = !idHydGreenPressurised->get();
   elacs[elacIndex].modelInputs.in.discrete_inputs.elac_engaged_from_switch = idElacPushbuttonPressed[elacIndex]->get();
-  elacs[elacIndex].modelInputs.in.discrete_inputs.normal_powersupply_lost = false;
-
-  elacs[elacIndex].modelInputs.in.analog_inputs.capt_pitch_stick_pos = -simInput.inputs[0];
-  elacs[elacIndex].modelInputs.in.analog_inputs.fo_pitch_stick_pos = 0;
-  elacs[elacIndex].modelInputs.in.analog_inputs.capt_roll_stick_pos = -simInput.inputs[1];
-  elacs[elacIndex].modelInputs.in.analog_inputs.fo_roll_stick_pos = 0;
-  double leftElevPos = -idLeftElevatorPosition->get();
-  double rightElevPos = -idRightElevatorPosition->get();
-  elacs[elacIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = leftElevPos * 30;
-  elacs[elacIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = rightElevPos * 30;
-  elacs[elacIndex].modelInputs.in.analog_inputs.ths_pos_deg = -simData.eta_trim_deg;
-  elacs[elacIndex].modelInputs.in.analog_inputs.left_aileron_pos_deg = idLeftAileronPosition->get() * 25;
-  elacs[elacIndex].modelInputs.in.analog_inputs.right_aileron_pos_deg = -idRightAileronPosition->get() * 25;
-  elacs[elacIndex].modelInputs.in.analog_inputs.rudder_pedal_pos = -simInput.inputs[2];
-  elacs[elacIndex].modelInputs.in.analog_inputs.load_factor_acc_1_g = 0;
-  elacs[elacIndex].modelInputs.in.analog_inputs.load_factor_acc_2_g = 0;
-  elacs[elacIndex].modelInputs.in.analog_inputs.blue_hyd_pressure_psi = idHydBlueSystemPressure->get();
-  elacs[elacIndex].modelInputs.in.analog_inputs.green_hyd_pressure_psi = idHydGreenSystemPressure->get();
-  elacs[elacIndex].modelInputs.in.analog_inputs.yellow_hyd_pressure_psi = idHydYellowSystemPressure->get();
-
-  elacs[elacIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_1_bus = fmgcBBusOutputs;
-  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_2_bus = fmgcBBusOutputs;
-  elacs[elacIndex].modelInputs.in.bus_inputs.ra_1_bus = raBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ra_2_bus = raBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sec_1_bus = secsBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sec_2_bus = secsBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
-
-  if (elacIndex == elacDisabled) {
-    simConnectInterface.setClientDataElacDiscretes(elacs[elacIndex].modelInputs.in.discrete_inputs);
-    simConnectInterface.setClientDataElacAnalog(elacs[elacIndex].modelInputs.in.analog_inputs);
 
-    elacsDiscreteOutputs[elacIndex] = simConnectInterface.getClientDataElacDiscretesOutput();
-    elacsAnalogOutputs[elacIndex] = simConnectInterface.getClientDataElacAnalogsOutput();
-    elacsBusOutputs[elacIndex] = simConnectInterface.getClientDataElacBusOutput();
-  } else {
+  bool modelStepRequired = true;
+  if (elacIndex != elacDisabled) {
     bool powerSupplyAvailable = false;
     if (elacIndex == 0) {
       powerSupplyAvailable =
@@ -1361,8 +1313,98 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
       powerSupplyAvailable = elac2EmerPowersupplyActive ? idElecBat2HotBusPowered->get() : idElecDcBus2Powered->get();
     }
 
-    elacs[elacIndex].update(sampleTime, simData.simulationTime,
-                            failuresConsumer.isActive(elacIndex == 0 ? Failures::Elac1 : Failures::Elac2), powerSupplyAvailable);
+    modelStepRequired = elacs[elacIndex].updateMonitoring(
+        sampleTime, failuresConsumer.isActive(elacIndex == 0 ? Failures::Elac1 : Failures::Elac2), powerSupplyAvailable);
+  }
+
+  if (modelStepRequired) {
+    elacs[elacIndex].modelInputs.in.time.dt = sampleTime;
+    elacs[elacIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
+    elacs[elacIndex].modelInputs.in.time.monotonic_time = monotonicTime;
+
+    elacs[elacIndex].modelInputs.in.sim_data.slew_on = wasInSlew;
+    elacs[elacIndex].modelInputs.in.sim_data.pause_on = pauseDetected;
+    elacs[elacIndex].modelInputs.in.sim_data.tracking_mode_on_override = idExternalOverride->get() == 1;
+    elacs[elacIndex].modelInputs.in.sim_data.tailstrike_protection_on = tailstrikeProtectionEnabled;
+
+    elacs[elacIndex].modelInputs.in.discrete_inputs.ground_spoilers_active_1 = secsDiscreteOutputs[0].ground_spoiler_out;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.ground_spoilers_active_2 =
+        elacIndex == 0 ? secsDiscreteOutputs[1].ground_spoiler_out : secsDiscreteOutputs[2].ground_spoiler_out;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.is_unit_1 = elacIndex == 0;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.is_unit_2 = elacIndex == 1;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.opp_axis_pitch_failure = !elacsDiscreteOutputs[oppElacIndex].pitch_axis_ok;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.ap_1_disengaged = !autopilotStateMachineOutput.enabled_AP1;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.ap_2_disengaged = !autopilotStateMachineOutput.enabled_AP2;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.opp_left_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].left_aileron_ok;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.opp_right_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].right_aileron_ok;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.fac_1_yaw_control_lost = !facsDiscreteOutputs[0].yaw_damper_avail_for_norm_law;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_nose_gear_pressed = idLgciuNoseGearCompressed[0]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_nose_gear_pressed = idLgciuNoseGearCompressed[1]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.fac_2_yaw_control_lost = !facsDiscreteOutputs[1].yaw_damper_avail_for_norm_law;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_right_main_gear_pressed = idLgciuRightMainGearCompressed[0]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_right_main_gear_pressed = idLgciuRightMainGearCompressed[1]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_left_main_gear_pressed = idLgciuLeftMainGearCompressed[0]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_left_main_gear_pressed = idLgciuLeftMainGearCompressed[1]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.ths_motor_fault = false;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.sfcc_1_slats_out = false;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.sfcc_2_slats_out = false;
+    elacs[elacIndex].modelInputs.in.discrete_inputs.l_ail_servo_failed = idAilFaultLeft[elacIndex]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.l_elev_servo_failed = idElevFaultLeft[elacIndex]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.r_ail_servo_failed = idAilFaultRight[elacIndex]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.r_elev_servo_failed = idElevFaultRight[elacIndex]->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.ths_override_active = idThsOverrideActive->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.capt_priority_takeover_pressed = idCaptPriorityButtonPressed->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.fo_priority_takeover_pressed = idFoPriorityButtonPressed->get();
+    elacs[elacIndex].modelInputs.in.discrete_inputs.normal_powersupply_lost = false;
+
+    elacs[elacIndex].modelInputs.in.analog_inputs.capt_pitch_stick_pos = -simInput.inputs[0];
+    elacs[elacIndex].modelInputs.in.analog_inputs.fo_pitch_stick_pos = 0;
+    elacs[elacIndex].modelInputs.in.analog_inputs.capt_roll_stick_pos = -simInput.inputs[1];
+    elacs[elacIndex].modelInputs.in.analog_inputs.fo_roll_stick_pos = 0;
+    double leftElevPos = -idLeftElevatorPosition->get();
+    double rightElevPos = -idRightElevatorPosition->get();
+    elacs[elacIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = leftElevPos * 30;
+    elacs[elacIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = rightElevPos * 30;
+    elacs[elacIndex].modelInputs.in.analog_inputs.ths_pos_deg = -simData.eta_trim_deg;
+    elacs[elacIndex].modelInputs.in.analog_inputs.left_aileron_pos_deg = idLeftAileronPosition->get() * 25;
+    elacs[elacIndex].modelInputs.in.analog_inputs.right_aileron_pos_deg = -idRightAileronPosition->get() * 25;
+    elacs[elacIndex].modelInputs.in.analog_inputs.rudder_pedal_pos = -simInput.inputs[2];
+    elacs[elacIndex].modelInputs.in.analog_inputs.load_factor_acc_1_g = 0;
+    elacs[elacIndex].modelInputs.in.analog_inputs.load_factor_acc_2_g = 0;
+    elacs[elacIndex].modelInputs.in.analog_inputs.blue_hyd_pressure_psi = idHydBlueSystemPressure->get();
+    elacs[elacIndex].modelInputs.in.analog_inputs.green_hyd_pressure_psi = idHydGreenSystemPressure->get();
+    elacs[elacIndex].modelInputs.in.analog_inputs.yellow_hyd_pressure_psi = idHydYellowSystemPressure->get();
+
+    elacs[elacIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+    elacs[elacIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
+    elacs[elacIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+    elacs[elacIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
+    elacs[elacIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
+    elacs[elacIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
+    elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_1_bus = fmgcBBusOutputs;
+    elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_2_bus = fmgcBBusOutputs;
+    elacs[elacIndex].modelInputs.in.bus_inputs.ra_1_bus = raBusOutputs[0];
+    elacs[elacIndex].modelInputs.in.bus_inputs.ra_2_bus = raBusOutputs[1];
+    elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+    elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+    elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+    elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+    elacs[elacIndex].modelInputs.in.bus_inputs.sec_1_bus = secsBusOutputs[0];
+    elacs[elacIndex].modelInputs.in.bus_inputs.sec_2_bus = secsBusOutputs[1];
+    elacs[elacIndex].modelInputs.in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
+  }
+
+  if (elacIndex == elacDisabled) {
+    simConnectInterface.setClientDataElacDiscretes(elacs[elacIndex].modelInputs.in.discrete_inputs);
+    simConnectInterface.setClientDataElacAnalog(elacs[elacIndex].modelInputs.in.analog_inputs);
+
+    elacsDiscreteOutputs[elacIndex] = simConnectInterface.getClientDataElacDiscretesOutput();
+    elacsAnalogOutputs[elacIndex] = simConnectInterface.getClientDataElacAnalogsOutput();
+    elacsBusOutputs[elacIndex] = simConnectInterface.getClientDataElacBusOutput();
+  } else {
+    if (modelStepRequired) {
+      elacs[elacIndex].updateModel();
+    }
 
     elacsDiscreteOutputs[elacIndex] = elacs[elacIndex].getDiscreteOutputs();
     elacsAnalogOutputs[elacIndex] = elacs[elacIndex].getAnalogOutputs();
@@ -1388,120 +1430,140 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
   SimData simData = simConnectInterface.getSimData();
   SimInput simInput = simConnectInterface.getSimInput();
 
-  secs[secIndex].modelInputs.in.time.dt = sampleTime;
-  secs[secIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
-  secs[secIndex].modelInputs.in.time.monotonic_time = monotonicTime;
+  // The inputs used by the computer monitoring are always required.
+  secs[secIndex].modelInputs.in.discrete_inputs.sec_engaged_from_switch = idSecPushbuttonPressed[secIndex]->get();
 
-  secs[secIndex].modelInputs.in.sim_data.slew_on = wasInSlew;
-  secs[secIndex].modelInputs.in.sim_data.pause_on = pauseDetected;
-  secs[secIndex].modelInputs.in.sim_data.tracking_mode_on_override = idExternalOverride->get() == 1;
-  secs[secIndex].modelInputs.in.sim_data.tailstrike_protection_on = tailstrikeProtectionEnabled;
+  bool modelStepRequired = true;
+  if (secIndex != secDisabled) {
+    bool powerSupplyAvailable = false;
+    if (secIndex == 0) {
+      powerSupplyAvailable =
+          idElecDcEssBusPowered->get() ||
+          ((secsDiscreteOutputs[0].batt_power_supply || elacsDiscreteOutputs[0].batt_power_supply) ? idElecBat1HotBusPowered->get()
+                                                                                                   : false);
+    } else {
+      powerSupplyAvailable = idElecDcBus2Powered->get();
+    }
 
-  secs[secIndex].modelInputs.in.discrete_inputs.sec_engaged_from_switch = idSecPushbuttonPressed[secIndex]->get();
-  secs[secIndex].modelInputs.in.discrete_inputs.sec_in_emergency_powersupply = false;
-  secs[secIndex].modelInputs.in.discrete_inputs.is_unit_1 = secIndex == 0;
-  secs[secIndex].modelInputs.in.discrete_inputs.is_unit_2 = secIndex == 1;
-  secs[secIndex].modelInputs.in.discrete_inputs.is_unit_3 = secIndex == 2;
-  if (secIndex < 2) {
-    secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_1 = !elacsDiscreteOutputs[0].pitch_axis_ok;
-    secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_2 = !elacsDiscreteOutputs[1].pitch_axis_ok;
-    secs[secIndex].modelInputs.in.discrete_inputs.left_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].left_elevator_ok;
-    secs[secIndex].modelInputs.in.discrete_inputs.right_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].right_elevator_ok;
-    secs[secIndex].modelInputs.in.discrete_inputs.ths_motor_fault = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.l_elev_servo_failed = idElevFaultLeft[secIndex]->get();
-    secs[secIndex].modelInputs.in.discrete_inputs.r_elev_servo_failed = idElevFaultRight[secIndex]->get();
-    secs[secIndex].modelInputs.in.discrete_inputs.ths_override_active = idThsOverrideActive->get();
-  } else {
-    secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_1 = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_2 = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.left_elev_not_avail_sec_opp = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.right_elev_not_avail_sec_opp = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.ths_motor_fault = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.l_elev_servo_failed = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.r_elev_servo_failed = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.ths_override_active = false;
-  }
-
-  secs[secIndex].modelInputs.in.discrete_inputs.digital_output_failed_elac_1 = !elacsDiscreteOutputs[0].digital_output_validated;
-  secs[secIndex].modelInputs.in.discrete_inputs.digital_output_failed_elac_2 = !elacsDiscreteOutputs[1].digital_output_validated;
-  secs[secIndex].modelInputs.in.discrete_inputs.green_low_pressure = !idHydGreenPressurised->get();
-  secs[secIndex].modelInputs.in.discrete_inputs.blue_low_pressure = !idHydBluePressurised->get();
-  secs[secIndex].modelInputs.in.discrete_inputs.yellow_low_pressure = !idHydYellowPressurised->get();
-  secs[secIndex].modelInputs.in.discrete_inputs.sfcc_1_slats_out = false;
-  secs[secIndex].modelInputs.in.discrete_inputs.sfcc_2_slats_out = false;
-
-  int splrIndex = secIndex == 2 ? 0 : (secIndex == 0 ? 2 : 4);
-
-  secs[secIndex].modelInputs.in.discrete_inputs.l_spoiler_1_servo_failed = idSplrFaultLeft[splrIndex]->get();
-  secs[secIndex].modelInputs.in.discrete_inputs.r_spoiler_1_servo_failed = idSplrFaultRight[splrIndex]->get();
-  if (secIndex != 1) {
-    secs[secIndex].modelInputs.in.discrete_inputs.l_spoiler_2_servo_failed = idSplrFaultLeft[splrIndex + 1]->get();
-    secs[secIndex].modelInputs.in.discrete_inputs.r_spoiler_2_servo_failed = idSplrFaultRight[splrIndex + 1]->get();
-  } else {
-    secs[secIndex].modelInputs.in.discrete_inputs.l_spoiler_2_servo_failed = false;
-    secs[secIndex].modelInputs.in.discrete_inputs.r_spoiler_2_servo_failed = false;
-  }
+    Failures failureIndex = secIndex == 0 ? Failures::Sec1 : (secIndex == 1 ? Failures::Sec2 : Failures::Sec3);
+    modelStepRequired = secs[secIndex].updateMonitoring(sampleTime, failuresConsumer.isActive(failureIndex), powerSupplyAvailable);
+  }
+
+  if (modelStepRequired) {
+    secs[secIndex].modelInputs.in.time.dt = sampleTime;
+    secs[secIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
+    secs[secIndex].modelInputs.in.time.monotonic_time = monotonicTime;
+
+    secs[secIndex].modelInputs.in.sim_data.slew_on = wasInSlew;
+    secs[secIndex].modelInputs.in.sim_data.pause_on = pauseDetected;
+    secs[secIndex].modelInputs.in.sim_data.tracking_mode_on_override = idExternalOverride->get() == 1;
+    secs[secIndex].modelInputs.in.sim_data.tailstrike_protection_on = tailstrikeProtectionEnabled;
+
+    secs[secIndex].modelInputs.in.discrete_inputs.sec_in_emergency_powersupply = false;
+    secs[secIndex].modelInputs.in.discrete_inputs.is_unit_1 = secIndex == 0;
+    secs[secIndex].modelInputs.in.discrete_inputs.is_unit_2 = secIndex == 1;
+    secs[secIndex].modelInputs.in.discrete_inputs.is_unit_3 = secIndex == 2;
+    if (secIndex < 2) {
+      secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_1 = !elacsDiscreteOutputs[0].pitch_axis_ok;
+      secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_2 = !elacsDiscreteOutputs[1].pitch_axis_ok;
+      secs[secIndex].modelInputs.in.discrete_inputs.left_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].left_elevator_ok;
+      secs[secIndex].modelInputs.in.discrete_inputs.right_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].right_elevator_ok;
+      secs[secIndex].modelInputs.in.discrete_inputs.ths_motor_fault = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.l_elev_servo_failed = idElevFaultLeft[secIndex]->get();
+      secs[secIndex].modelInputs.in.discrete_inputs.r_elev_servo_failed = idElevFaultRight[secIndex]->get();
+      secs[secIndex].modelInputs.in.discrete_inputs.ths_override_active = idThsOverrideActive->get();
+    } else {
+      secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_1 = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_2 = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.left_elev_not_avail_sec_opp = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.right_elev_not_avail_sec_opp = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.ths_motor_fault = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.l_elev_servo_failed = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.r_elev_servo_failed = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.ths_override_active = false;
+    }
 
-  secs[secIndex].modelInputs.in.discrete_inputs.capt_priority_takeover_pressed = idCaptPriorityButtonPressed->get();
-  secs[secIndex].modelInputs.in.discrete_inputs.fo_priority_takeover_pressed = idFoPriorityButtonPressed->get();
+    secs[secIndex].modelInputs.in.discrete_inputs.digital_output_failed_elac_1 = !elacsDiscreteOutputs[0].digital_output_validated;
+    secs[secIndex].modelInputs.in.discrete_inputs.digital_output_failed_elac_2 = !elacsDiscreteOutputs[1].digital_output_validated;
+    secs[secIndex].modelInputs.in.discrete_inputs.green_low_pressure = !idHydGreenPressurised->get();
+    secs[secIndex].modelInputs.in.discrete_inputs.blue_low_pressure = !idHydBluePressurised->get();
+    secs[secIndex].modelInputs.in.discrete_inputs.yellow_low_pressure = !idHydYellowPressurised->get();
+    secs[secIndex].modelInputs.in.discrete_inputs.sfcc_1_slats_out = false;
+    secs[secIndex].modelInputs.in.discrete_inputs.sfcc_2_slats_out = false;
+
+    int splrIndex = secIndex == 2 ? 0 : (secIndex == 0 ? 2 : 4);
+
+    secs[secIndex].modelInputs.in.discrete_inputs.l_spoiler_1_servo_failed = idSplrFaultLeft[splrIndex]->get();
+    secs[secIndex].modelInputs.in.discrete_inputs.r_spoiler_1_servo_failed = idSplrFaultRight[splrIndex]->get();
+    if (secIndex != 1) {
+      secs[secIndex].modelInputs.in.discrete_inputs.l_spoiler_2_servo_failed = idSplrFaultLeft[splrIndex + 1]->get();
+      secs[secIndex].modelInputs.in.discrete_inputs.r_spoiler_2_servo_failed = idSplrFaultRight[splrIndex + 1]->get();
+    } else {
+      secs[secIndex].modelInputs.in.discrete_inputs.l_spoiler_2_servo_failed = false;
+      secs[secIndex].modelInputs.in.discrete_inputs.r_spoiler_2_servo_failed = false;
+    }
 
-  if (secIndex < 2) {
-    secs[secIndex].modelInputs.in.analog_inputs.capt_pitch_stick_pos = -simInput.inputs[0];
-    secs[secIndex].modelInputs.in.analog_inputs.fo_pitch_stick_pos = 0;
-    double leftElevPos = -idLeftElevatorPosition->get();
-    double rightElevPos = -idRightElevatorPosition->get();
-    secs[secIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = leftElevPos * 30;
-    secs[secIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = rightElevPos * 30;
-    secs[secIndex].modelInputs.in.analog_inputs.ths_pos_deg = -simData.eta_trim_deg;
-    secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_1_g = 0;
-    secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_2_g = 0;
-  } else {
-    secs[secIndex].modelInputs.in.analog_inputs.capt_pitch_stick_pos = 0;
-    secs[secIndex].modelInputs.in.analog_inputs.fo_pitch_stick_pos = 0;
-    secs[secIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = 0;
-    secs[secIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = 0;
-    secs[secIndex].modelInputs.in.analog_inputs.ths_pos_deg = 0;
-    secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_1_g = 0;
-    secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_2_g = 0;
-  }
-  secs[secIndex].modelInputs.in.analog_inputs.capt_roll_stick_pos = -simInput.inputs[1];
-  secs[secIndex].modelInputs.in.analog_inputs.fo_roll_stick_pos = 0;
-  secs[secIndex].modelInputs.in.analog_inputs.spd_brk_lever_pos =
-      spoilersHandler->getIsArmed() ? -0.05 : spoilersHandler->getHandlePosition();
-  secs[secIndex].modelInputs.in.analog_inputs.thr_lever_1_pos = thrustLeverAngle_1->get();
-  secs[secIndex].modelInputs.in.analog_inputs.thr_lever_2_pos = thrustLeverAngle_2->get();
-  secs[secIndex].modelInputs.in.analog_inputs.left_spoiler_1_pos_deg = -idLeftSpoilerPosition[splrIndex]->get() * 50;
-  secs[secIndex].modelInputs.in.analog_inputs.right_spoiler_1_pos_deg = -idRightSpoilerPosition[splrIndex]->get() * 50;
-  secs[secIndex].modelInputs.in.analog_inputs.left_spoiler_2_pos_deg = -idLeftSpoilerPosition[splrIndex + 1]->get() * 50;
-  secs[secIndex].modelInputs.in.analog_inputs.right_spoiler_2_pos_deg = -idRightSpoilerPosition[splrIndex + 1]->get() * 50;
-  secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_left = simData.wheelRpmLeft * 0.118921;
-  secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_right = simData.wheelRpmRight * 0.118921;
-
-  if (secIndex == 0) {
-    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
-  } else if (secIndex == 1) {
-    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
-  } else if (secIndex == 2) {
-    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[1];
-    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[1];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
-  }
-
-  secs[secIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
-  secs[secIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
-  secs[secIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
-  secs[secIndex].modelInputs.in.bus_inputs.lgciu_1_bus = lgciuBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.lgciu_2_bus = lgciuBusOutputs[1];
+    secs[secIndex].modelInputs.in.discrete_inputs.capt_priority_takeover_pressed = idCaptPriorityButtonPressed->get();
+    secs[secIndex].modelInputs.in.discrete_inputs.fo_priority_takeover_pressed = idFoPriorityButtonPressed->get();
+
+    if (secIndex < 2) {
+      secs[secIndex].modelInputs.in.analog_inputs.capt_pitch_stick_pos = -simInput.inputs[0];
+      secs[secIndex].modelInputs.in.analog_inputs.fo_pitch_stick_pos = 0;
+      double leftElevPos = -idLeftElevatorPosition->get();
+      double rightElevPos = -idRightElevatorPosition->get();
+      secs[secIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = leftElevPos * 30;
+      secs[secIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = rightElevPos * 30;
+      secs[secIndex].modelInputs.in.analog_inputs.ths_pos_deg = -simData.eta_trim_deg;
+      secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_1_g = 0;
+      secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_2_g = 0;
+    } else {
+      secs[secIndex].modelInputs.in.analog_inputs.capt_pitch_stick_pos = 0;
+      secs[secIndex].modelInputs.in.analog_inputs.fo_pitch_stick_pos = 0;
+      secs[secIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = 0;
+      secs[secIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = 0;
+      secs[secIndex].modelInputs.in.analog_inputs.ths_pos_deg = 0;
+      secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_1_g = 0;
+      secs[secIndex].modelInputs.in.analog_inputs.load_factor_acc_2_g = 0;
+    }
+    secs[secIndex].modelInputs.in.analog_inputs.capt_roll_stick_pos = -simInput.inputs[1];
+    secs[secIndex].modelInputs.in.analog_inputs.fo_roll_stick_pos = 0;
+    secs[secIndex].modelInputs.in.analog_inputs.spd_brk_lever_pos =
+        spoilersHandler->getIsArmed() ? -0.05 : spoilersHandler->getHandlePosition();
+    secs[secIndex].modelInputs.in.analog_inputs.thr_lever_1_pos = thrustLeverAngle_1->get();
+    secs[secIndex].modelInputs.in.analog_inputs.thr_lever_2_pos = thrustLeverAngle_2->get();
+    secs[secIndex].modelInputs.in.analog_inputs.left_spoiler_1_pos_deg = -idLeftSpoilerPosition[splrIndex]->get() * 50;
+    secs[secIndex].modelInputs.in.analog_inputs.right_spoiler_1_pos_deg = -idRightSpoilerPosition[splrIndex]->get() * 50;
+    secs[secIndex].modelInputs.in.analog_inputs.left_spoiler_2_pos_deg = -idLeftSpoilerPosition[splrIndex + 1]->get() * 50;
+    secs[secIndex].modelInputs.in.analog_inputs.right_spoiler_2_pos_deg = -idRightSpoilerPosition[splrIndex + 1]->get() * 50;
+    secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_left = simData.wheelRpmLeft * 0.118921;
+    secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_right = simData.wheelRpmRight * 0.118921;
+
+    if (secIndex == 0) {
+      secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+      secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
+      secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
+      secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
+    } else if (secIndex == 1) {
+      secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+      secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
+      secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
+      secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
+    } else if (secIndex == 2) {
+      secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[1];
+      secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
+      secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[1];
+      secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
+    }
+
+    secs[secIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+    secs[secIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+    secs[secIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+    secs[secIndex].modelInputs.in.bus_inputs.lgciu_1_bus = lgciuBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.lgciu_2_bus = lgciuBusOutputs[1];
+  }
 
   if (secIndex == secDisabled) {
     simConnectInterface.setClientDataSecDiscretes(secs[secIndex].modelInputs.in.discrete_inputs);
@@ -1511,19 +1573,10 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
     secsAnalogOutputs[secIndex] = simConnectInterface.getClientDataSecAnalogsOutput();
     secsBusOutputs[secIndex] = simConnectInterface.getClientDataSecBusOutput();
   } else {
-    bool powerSupplyAvailable = false;
-    if (secIndex == 0) {
-      powerSupplyAvailable =
-          idElecDcEssBusPowered->get() ||
-          ((secsDiscreteOutputs[0].batt_power_supply || elacsDiscreteOutputs[0].batt_power_supply) ? idElecBat1HotBusPowered->get()
-                                                                                                   : false);
-    } else {
-      powerSupplyAvailable = idElecDcBus2Powered->get();
+    if (modelStepRequired) {
+      secs[secIndex].updateModel();
     }
 
-    Failures failureIndex = secIndex == 0 ? Failures::Sec1 : (secIndex == 1 ? Failures::Sec2 : Failures::Sec3);
-    secs[secIndex].update(sampleTime, simData.simulationTime, failuresConsumer.isActive(failureIndex), powerSupplyAvailable);
-
     secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
     secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
     secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
@@ -1542,60 +1595,45 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
 bool FlyByWireInterface::updateFcdc(double sampleTime, int fcdcIndex) {
   const int oppFcdcIndex = fcdcIndex == 0 ? 1 : 0;
 
-  fcdcs[fcdcIndex].discreteInputs.elac1Off = !idElacPushbuttonPressed[0]->get();
-  fcdcs[fcdcIndex].discreteInputs.elac1Valid = elacsDiscreteOutputs[0].digital_output_validated;
-  fcdcs[fcdcIndex].discreteInputs.elac2Valid = elacsDiscreteOutputs[1].digital_output_validated;
-  fcdcs[fcdcIndex].discreteInputs.sec1Off = !idSecPushbuttonPressed[0]->get();
-  fcdcs[fcdcIndex].discreteInputs.sec1Valid = !secsDiscreteOutputs[0].sec_failed;
-  fcdcs[fcdcIndex].discreteInputs.sec2Valid = !secsDiscreteOutputs[1].sec_failed;
+  // The inputs used by the startup sequence are always required.
   fcdcs[fcdcIndex].discreteInputs.eng1NotOnGroundAndNotLowOilPress = false;
   fcdcs[fcdcIndex].discreteInputs.eng2NotOnGroundAndNotLowOilPress = false;
   fcdcs[fcdcIndex].discreteInputs.noseGearPressed = idLgciuNoseGearCompressed[0]->get();
-  fcdcs[fcdcIndex].discreteInputs.oppFcdcFailed = !fcdcsDiscreteOutputs[oppFcdcIndex].fcdcValid;
-  fcdcs[fcdcIndex].discreteInputs.sec3Off = !idSecPushbuttonPressed[2]->get();
-  fcdcs[fcdcIndex].discreteInputs.sec3Valid = !secsDiscreteOutputs[2].sec_failed;
-  fcdcs[fcdcIndex].discreteInputs.elac2Off = !idElacPushbuttonPressed[1]->get();
-  fcdcs[fcdcIndex].discreteInputs.sec2Off = !idSecPushbuttonPressed[1]->get();
-
-  fcdcs[fcdcIndex].busInputs.elac1 = elacsBusOutputs[0];
-  fcdcs[fcdcIndex].busInputs.sec1 = secsBusOutputs[0];
-  fcdcs[fcdcIndex].busInputs.fcdcOpp = fcdcsBusOutputs[oppFcdcIndex];
-  fcdcs[fcdcIndex].busInputs.elac2 = elacsBusOutputs[1];
-  fcdcs[fcdcIndex].busInputs.sec2 = secsBusOutputs[1];
-  fcdcs[fcdcIndex].busInputs.sec3 = secsBusOutputs[2];
-
-  fcdcs[fcdcIndex].update(sampleTime, failuresConsumer.isActive(fcdcIndex == 0 ? Failures::Fcdc1 : Failures::Fcdc2),
-                          fcdcIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get());
+
+  if (fcdcs[fcdcIndex].updateMonitoring(sampleTime, failuresConsumer.isActive(fcdcIndex == 0 ? Failures::Fcdc1 : Failures::Fcdc2),
+                                         fcdcIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get())) {
+    fcdcs[fcdcIndex].discreteInputs.elac1Off = !idElacPushbuttonPressed[0]->get();
+    fcdcs[fcdcIndex].discreteInputs.elac1Valid = elacsDiscreteOutputs[0].digital_output_validated;
+    fcdcs[fcdcIndex].discreteInputs.elac2Valid = elacsDiscreteOutputs[1].digital_output_validated;
+    fcdcs[fcdcIndex].discreteInputs.sec1Off = !idSecPushbuttonPressed[0]->get();
+    fcdcs[fcdcIndex].discreteInputs.sec1Valid = !secsDiscreteOutputs[0].sec_failed;
+    fcdcs[fcdcIndex].discreteInputs.sec2Valid = !secsDiscreteOutputs[1].sec_failed;
+    fcdcs[fcdcIndex].discreteInputs.oppFcdcFailed = !fcdcsDiscreteOutputs[oppFcdcIndex].fcdcValid;
+    fcdcs[fcdcIndex].discreteInputs.sec3Off = !idSecPushbuttonPressed[2]->get();
+    fcdcs[fcdcIndex].discreteInputs.sec3Valid = !secsDiscreteOutputs[2].sec_failed;
+    fcdcs[fcdcIndex].discreteInputs.elac2Off = !idElacPushbuttonPressed[1]->get();
+    fcdcs[fcdcIndex].discreteInputs.sec2Off = !idSecPushbuttonPressed[1]->get();
+
+    fcdcs[fcdcIndex].busInputs.elac1 = elacsBusOutputs[0];
+    fcdcs[fcdcIndex].busInputs.sec1 = secsBusOutputs[0];
+    fcdcs[fcdcIndex].busInputs.fcdcOpp = fcdcsBusOutputs[oppFcdcIndex];
+    fcdcs[fcdcIndex].busInputs.elac2 = elacsBusOutputs[1];
+    fcdcs[fcdcIndex].busInputs.sec2 = secsBusOutputs[1];
+    fcdcs[fcdcIndex].busInputs.sec3 = secsBusOutputs[2];
+
+    fcdcs[fcdcIndex].updateModel(sampleTime);
+  }
 
   fcdcsDiscreteOutputs[fcdcIndex] = fcdcs[fcdcIndex].getDiscreteOutputs();
   FcdcBus bus = fcdcs[fcdcIndex].getBusOutputs();
   fcdcsBusOutputs[fcdcIndex] = *reinterpret_cast<base_fcdc_bus*>(&bus);
 
-  idFcdcDiscreteWord1[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_1));
-  idFcdcDiscreteWord2[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_2));
-  idFcdcDiscreteWord3[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_3));
-  idFcdcDiscreteWord4[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_4));
-  idFcdcDiscreteWord5[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_5));
-  idFcdcCaptRollCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].capt_roll_command_deg));
-  idFcdcFoRollCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].fo_roll_command_deg));
-  idFcdcCaptPitchCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].capt_pitch_command_deg));
-  idFcdcFoPitchCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].fo_pitch_command_deg));
-  idFcdcRudderPedalPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].rudder_pedal_position_deg));
-  idFcdcAileronLeftPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].aileron_left_pos_deg));
-  idFcdcElevatorLeftPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].elevator_left_pos_deg));
-  idFcdcAileronRightPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].aileron_right_pos_deg));
-  idFcdcElevatorRightPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].elevator_right_pos_deg));
-  idFcdcElevatorTrimPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].horiz_stab_trim_pos_deg));
-  idFcdcSpoilerLeft1Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_1_left_pos_deg));
-  idFcdcSpoilerLeft2Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_2_left_pos_deg));
-  idFcdcSpoilerLeft3Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_3_left_pos_deg));
-  idFcdcSpoilerLeft4Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_4_left_pos_deg));
-  idFcdcSpoilerLeft5Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_5_left_pos_deg));
-  idFcdcSpoilerRight1Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_1_right_pos_deg));
-  idFcdcSpoilerRight2Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_2_right_pos_deg));
-  idFcdcSpoilerRight3Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_3_right_pos_deg));
-  idFcdcSpoilerRight4Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_4_right_pos_deg));
-  idFcdcSpoilerRight5Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_5_right_pos_deg));
+  // the words of the bus are encoded in one pass and written to the Lvars in the same order
+  double busSimVars[Arinc429Codec::wordCount<base_fcdc_bus>()];
+  Arinc429Codec::encodeBus(fcdcsBusOutputs[fcdcIndex], busSimVars);
+  for (std::size_t i = 0; i < Arinc429Codec::wordCount<base_fcdc_bus>(); i++) {
+    fcdcBusVariables[fcdcIndex][i]->set(busSimVars[i]);
+  }
 
   idFcdcPriorityCaptGreen[fcdcIndex]->set(fcdcsDiscreteOutputs[fcdcIndex].captGreenPriorityLightOn);
   idFcdcPriorityCaptRed[fcdcIndex]->set(fcdcsDiscreteOutputs[fcdcIndex].captRedPriorityLightOn);
@@ -1615,60 +1653,72 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
   SimData simData = simConnectInterface.getSimData();
   SimInputRudderTrim trimInput = simConnectInterface.getSimInputRudderTrim();
 
-  facs[facIndex].modelInputs.in.time.dt = sampleTime;
-  facs[facIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
-  facs[facIndex].modelInputs.in.time.monotonic_time = monotonicTime;
-
-  facs[facIndex].modelInputs.in.sim_data.slew_on = wasInSlew;
-  facs[facIndex].modelInputs.in.sim_data.pause_on = pauseDetected;
-  facs[facIndex].modelInputs.in.sim_data.tracking_mode_on_override = idExternalOverride->get() == 1;
-  facs[facIndex].modelInputs.in.sim_data.tailstrike_protection_on = tailstrikeProtectionEnabled;
-
-  facs[facIndex].modelInputs.in.discrete_inputs.ap_own_engaged =
-      facIndex == 0 ? autopilotStateMachineOutput.enabled_AP1 : autopilotStateMachineOutput.enabled_AP2;
-  facs[facIndex].modelInputs.in.discrete_inputs.ap_opp_engaged =
-      facIndex == 0 ? autopilotStateMachineOutput.enabled_AP2 : autopilotStateMachineOutput.enabled_AP1;
-  facs[facIndex].modelInputs.in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
-  facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
-  facs[facIndex].modelInputs.in.discrete_inputs.rudder_travel_lim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
-  facs[facIndex].modelInputs.in.discrete_inputs.elac_1_healthy = elacsDiscreteOutputs[0].digital_output_validated;
-  facs[facIndex].modelInputs.in.discrete_inputs.elac_2_healthy = elacsDiscreteOutputs[1].digital_output_validated;
+  // The inputs used by the computer monitoring are always required.
   facs[facIndex].modelInputs.in.discrete_inputs.engine_1_stopped = true;
   facs[facIndex].modelInputs.in.discrete_inputs.engine_2_stopped = true;
-  facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_switch_left = trimInput.rudderTrimSwitchLeft;
-  facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_switch_right = trimInput.rudderTrimSwitchRight;
-  facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_reset_button = trimInput.rudderTrimReset;
   facs[facIndex].modelInputs.in.discrete_inputs.fac_engaged_from_switch = idFacPushbuttonPressed[facIndex]->get();
-  facs[facIndex].modelInputs.in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
-  facs[facIndex].modelInputs.in.discrete_inputs.is_unit_1 = facIndex == 0;
-  facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_actuator_healthy = true;
-  facs[facIndex].modelInputs.in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
-  // This should come from a dedicated discrete from the SFCC
-  facs[facIndex].modelInputs.in.discrete_inputs.slats_extended =
-      !reinterpret_cast<Arinc429DiscreteWord*>(&sfccBusOutputs[facIndex].slat_flap_actual_position_word)->bitFromValueOr(12, false);
   facs[facIndex].modelInputs.in.discrete_inputs.nose_gear_pressed = idLgciuNoseGearCompressed[facIndex]->get();
-  facs[facIndex].modelInputs.in.discrete_inputs.ir_3_switch = false;
-  facs[facIndex].modelInputs.in.discrete_inputs.adr_3_switch = false;
-  facs[facIndex].modelInputs.in.discrete_inputs.yaw_damper_has_hyd_press =
-      facIndex == 0 ? idHydGreenPressurised->get() : idHydYellowPressurised->get();
-
-  facs[facIndex].modelInputs.in.analog_inputs.yaw_damper_position_deg = 0;
-  facs[facIndex].modelInputs.in.analog_inputs.rudder_trim_position_deg = -idRudderTrimPosition->get();
-  facs[facIndex].modelInputs.in.analog_inputs.rudder_travel_lim_position_deg = idRudderTravelLimiterPosition->get();
-
-  facs[facIndex].modelInputs.in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
-  facs[facIndex].modelInputs.in.bus_inputs.adr_own_bus = facIndex == 0 ? adrBusOutputs[0] : adrBusOutputs[1];
-  facs[facIndex].modelInputs.in.bus_inputs.adr_opp_bus = facIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
-  facs[facIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
-  facs[facIndex].modelInputs.in.bus_inputs.ir_own_bus = facIndex == 0 ? irBusOutputs[0] : irBusOutputs[1];
-  facs[facIndex].modelInputs.in.bus_inputs.ir_opp_bus = facIndex == 0 ? irBusOutputs[1] : irBusOutputs[0];
-  facs[facIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
-  facs[facIndex].modelInputs.in.bus_inputs.fmgc_own_bus = fmgcBBusOutputs;
-  facs[facIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcBBusOutputs;
-  facs[facIndex].modelInputs.in.bus_inputs.sfcc_own_bus = sfccBusOutputs[facIndex];
-  facs[facIndex].modelInputs.in.bus_inputs.lgciu_own_bus = lgciuBusOutputs[facIndex];
-  facs[facIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
-  facs[facIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+
+  bool modelStepRequired = true;
+  if (facIndex != facDisabled) {
+    modelStepRequired =
+        facs[facIndex].updateMonitoring(sampleTime, failuresConsumer.isActive(facIndex == 0 ? Failures::Fac1 : Failures::Fac2),
+                                        facIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get());
+  }
+
+  if (modelStepRequired) {
+    facs[facIndex].modelInputs.in.time.dt = sampleTime;
+    facs[facIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
+    facs[facIndex].modelInputs.in.time.monotonic_time = monotonicTime;
+
+    facs[facIndex].modelInputs.in.sim_data.slew_on = wasInSlew;
+    facs[facIndex].modelInputs.in.sim_data.pause_on = pauseDetected;
+    facs[facIndex].modelInputs.in.sim_data.tracking_mode_on_override = idExternalOverride->get() == 1;
+    facs[facIndex].modelInputs.in.sim_data.tailstrike_protection_on = tailstrikeProtectionEnabled;
+
+    facs[facIndex].modelInputs.in.discrete_inputs.ap_own_engaged =
+        facIndex == 0 ? autopilotStateMachineOutput.enabled_AP1 : autopilotStateMachineOutput.enabled_AP2;
+    facs[facIndex].modelInputs.in.discrete_inputs.ap_opp_engaged =
+        facIndex == 0 ? autopilotStateMachineOutput.enabled_AP2 : autopilotStateMachineOutput.enabled_AP1;
+    facs[facIndex].modelInputs.in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
+    facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
+    facs[facIndex].modelInputs.in.discrete_inputs.rudder_travel_lim_opp_engaged =
+        facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
+    facs[facIndex].modelInputs.in.discrete_inputs.elac_1_healthy = elacsDiscreteOutputs[0].digital_output_validated;
+    facs[facIndex].modelInputs.in.discrete_inputs.elac_2_healthy = elacsDiscreteOutputs[1].digital_output_validated;
+    facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_switch_left = trimInput.rudderTrimSwitchLeft;
+    facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_switch_right = trimInput.rudderTrimSwitchRight;
+    facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_reset_button = trimInput.rudderTrimReset;
+    facs[facIndex].modelInputs.in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
+    facs[facIndex].modelInputs.in.discrete_inputs.is_unit_1 = facIndex == 0;
+    facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_actuator_healthy = true;
+    facs[facIndex].modelInputs.in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
+    // This should come from a dedicated discrete from the SFCC
+    facs[facIndex].modelInputs.in.discrete_inputs.slats_extended =
+        !reinterpret_cast<Arinc429DiscreteWord*>(&sfccBusOutputs[facIndex].slat_flap_actual_position_word)->bitFromValueOr(12, false);
+    facs[facIndex].modelInputs.in.discrete_inputs.ir_3_switch = false;
+    facs[facIndex].modelInputs.in.discrete_inputs.adr_3_switch = false;
+    facs[facIndex].modelInputs.in.discrete_inputs.yaw_damper_has_hyd_press =
+        facIndex == 0 ? idHydGreenPressurised->get() : idHydYellowPressurised->get();
+
+    facs[facIndex].modelInputs.in.analog_inputs.yaw_damper_position_deg = 0;
+    facs[facIndex].modelInputs.in.analog_inputs.rudder_trim_position_deg = -idRudderTrimPosition->get();
+    facs[facIndex].modelInputs.in.analog_inputs.rudder_travel_lim_position_deg = idRudderTravelLimiterPosition->get();
+
+    facs[facIndex].modelInputs.in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+    facs[facIndex].modelInputs.in.bus_inputs.adr_own_bus = facIndex == 0 ? adrBusOutputs[0] : adrBusOutputs[1];
+    facs[facIndex].modelInputs.in.bus_inputs.adr_opp_bus = facIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
+    facs[facIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+    facs[facIndex].modelInputs.in.bus_inputs.ir_own_bus = facIndex == 0 ? irBusOutputs[0] : irBusOutputs[1];
+    facs[facIndex].modelInputs.in.bus_inputs.ir_opp_bus = facIndex == 0 ? irBusOutputs[1] : irBusOutputs[0];
+    facs[facIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
+    facs[facIndex].modelInputs.in.bus_inputs.fmgc_own_bus = fmgcBBusOutputs;
+    facs[facIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcBBusOutputs;
+    facs[facIndex].modelInputs.in.bus_inputs.sfcc_own_bus = sfccBusOutputs[facIndex];
+    facs[facIndex].modelInputs.in.bus_inputs.lgciu_own_bus = lgciuBusOutputs[facIndex];
+    facs[facIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+    facs[facIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+  }
 
   if (facIndex == facDisabled) {
     simConnectInterface.setClientDataFacDiscretes(facs[facIndex].modelInputs.in.discrete_inputs);
@@ -1678,8 +1728,9 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
     facsAnalogOutputs[facIndex] = simConnectInterface.getClientDataFacAnalogsOutput();
     facsBusOutputs[facIndex] = simConnectInterface.getClientDataFacBusOutput();
   } else {
-    facs[facIndex].update(sampleTime, simData.simulationTime, failuresConsumer.isActive(facIndex == 0 ? Failures::Fac1 : Failures::Fac2),
-                          facIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get());
+    if (modelStepRequired) {
+      facs[facIndex].updateModel();
+    }
 
     facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
     facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
@@ -1726,59 +1777,109 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
   return true;
 }
 
+// The time of the rate groups is dropped so that it is not caught up afterwards, as are the inputs that arrived in the
+// meantime.
+void FlyByWireInterface::resetModelRateGroups() {
+  autopilotRateGroup.reset();
+  flightControlsRateGroup.reset();
+  simConnectInterface.resetSimInputAutopilot();
+  simConnectInterface.resetSimInputRudderTrim();
+}
+
+// The commands are interpolated from the previous towards the current computer output, so the surfaces follow the
+// computers with a lag of one flight controls period.
+double FlyByWireInterface::interpolateCommand(double previous, double current) {
+  return previous + (current - previous) * flightControlsRateGroup.getInterpolationFactor();
+}
+
 bool FlyByWireInterface::updateServoSolenoidStatus() {
   idLeftAileronSolenoidEnergized[0]->set(elacsDiscreteOutputs[0].left_aileron_active_mode);
-  idLeftAileronCommandedPosition[0]->set(elacsAnalogOutputs[0].left_aileron_pos_order);
+  idLeftAileronCommandedPosition[0]->set(interpolateCommand(elacsAnalogOutputsPrevious[0].left_aileron_pos_order,
+                                                            elacsAnalogOutputs[0].left_aileron_pos_order));
   idRightAileronSolenoidEnergized[0]->set(elacsDiscreteOutputs[0].right_aileron_active_mode);
-  idRightAileronCommandedPosition[0]->set(-elacsAnalogOutputs[0].right_aileron_pos_order);
+  idRightAileronCommandedPosition[0]->set(interpolateCommand(-elacsAnalogOutputsPrevious[0].right_aileron_pos_order,
+                                                             -elacsAnalogOutputs[0].right_aileron_pos_order));
   idLeftAileronSolenoidEnergized[1]->set(elacsDiscreteOutputs[1].left_aileron_active_mode);
-  idLeftAileronCommandedPosition[1]->set(elacsAnalogOutputs[1].left_aileron_pos_order);
+  idLeftAileronCommandedPosition[1]->set(interpolateCommand(elacsAnalogOutputsPrevious[1].left_aileron_pos_order,
+                                                            elacsAnalogOutputs[1].left_aileron_pos_order));
   idRightAileronSolenoidEnergized[1]->set(elacsDiscreteOutputs[1].right_aileron_active_mode);
-  idRightAileronCommandedPosition[1]->set(-elacsAnalogOutputs[1].right_aileron_pos_order);
-
-  idLeftSpoilerCommandedPosition[0]->set(-secsAnalogOutputs[2].left_spoiler_1_pos_order_deg);
-  idRightSpoilerCommandedPosition[0]->set(-secsAnalogOutputs[2].right_spoiler_1_pos_order_deg);
-  idLeftSpoilerCommandedPosition[1]->set(-secsAnalogOutputs[2].left_spoiler_2_pos_order_deg);
-  idRightSpoilerCommandedPosition[1]->set(-secsAnalogOutputs[2].right_spoiler_2_pos_order_deg);
-  idLeftSpoilerCommandedPosition[2]->set(-secsAnalogOutputs[0].left_spoiler_1_pos_order_deg);
-  idRightSpoilerCommandedPosition[2]->set(-secsAnalogOutputs[0].right_spoiler_1_pos_order_deg);
-  idLeftSpoilerCommandedPosition[3]->set(-secsAnalogOutputs[0].left_spoiler_2_pos_order_deg);
-  idRightSpoilerCommandedPosition[3]->set(-secsAnalogOutputs[0].right_spoiler_2_pos_order_deg);
-  idLeftSpoilerCommandedPosition[4]->set(-secsAnalogOutputs[1].left_spoiler_1_pos_order_deg);
-  idRightSpoilerCommandedPosition[4]->set(-secsAnalogOutputs[1].right_spoiler_1_pos_order_deg);
+  idRightAileronCommandedPosition[1]->set(interpolateCommand(-elacsAnalogOutputsPrevious[1].right_aileron_pos_order,
+                                                             -elacsAnalogOutputs[1].right_aileron_pos_order));
+
+  idLeftSpoilerCommandedPosition[0]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].left_spoiler_1_pos_order_deg,
+                                                            -secsAnalogOutputs[2].left_spoiler_1_pos_order_deg));
+  idRightSpoilerCommandedPosition[0]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].right_spoiler_1_pos_order_deg,
+                                                             -secsAnalogOutputs[2].right_spoiler_1_pos_order_deg));
+  idLeftSpoilerCommandedPosition[1]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].left_spoiler_2_pos_order_deg,
+                                                            -secsAnalogOutputs[2].left_spoiler_2_pos_order_deg));
+  idRightSpoilerCommandedPosition[1]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].right_spoiler_2_pos_order_deg,
+                                                             -secsAnalogOutputs[2].right_spoiler_2_pos_order_deg));
+  idLeftSpoilerCommandedPosition[2]->set(interpolateCommand(-secsAnalogOutputsPrevious[0].left_spoiler_1_pos_order_deg,
+                                                            -secsAnalogOutputs[0].left_spoiler_1_pos_order_deg));
+  idRightSpoilerCommandedPosition[2]->set(interpolateCommand(-secsAnalogOutputsPrevious[0].right_spoiler_1_pos_order_deg,
+                                                             -secsAnalogOutputs[0].right_spoiler_1_pos_order_deg));
+  idLeftSpoilerCommandedPosition[3]->set(interpolateCommand(-secsAnalogOutputsPrevious[0].left_spoiler_2_pos_order_deg,
+                                                            -secsAnalogOutputs[0].left_spoiler_2_pos_order_deg));
+  idRightSpoilerCommandedPosition[3]->set(interpolateCommand(-secsAnalogOutputsPrevious[0].right_spoiler_2_pos_order_deg,
+                                                             -secsAnalogOutputs[0].right_spoiler_2_pos_order_deg));
+  idLeftSpoilerCommandedPosition[4]->set(interpolateCommand(-secsAnalogOutputsPrevious[1].left_spoiler_1_pos_order_deg,
+                                                            -secsAnalogOutputs[1].left_spoiler_1_pos_order_deg));
+  idRightSpoilerCommandedPosition[4]->set(interpolateCommand(-secsAnalogOutputsPrevious[1].right_spoiler_1_pos_order_deg,
+                                                             -secsAnalogOutputs[1].right_spoiler_1_pos_order_deg));
 
   idLeftElevatorSolenoidEnergized[0]->set(elacsDiscreteOutputs[1].left_elevator_damping_mode ||
                                           secsDiscreteOutputs[1].left_elevator_damping_mode);
-  idLeftElevatorCommandedPosition[0]->set(elacsAnalogOutputs[0].left_elev_pos_order_deg + secsAnalogOutputs[0].left_elev_pos_order_deg);
+  idLeftElevatorCommandedPosition[0]->set(interpolateCommand(elacsAnalogOutputsPrevious[0].left_elev_pos_order_deg +
+                                                             secsAnalogOutputsPrevious[0].left_elev_pos_order_deg,
+                                                             elacsAnalogOutputs[0].left_elev_pos_order_deg +
+                                                             secsAnalogOutputs[0].left_elev_pos_order_deg));
   idRightElevatorSolenoidEnergized[0]->set(elacsDiscreteOutputs[1].right_elevator_damping_mode ||
                                            secsDiscreteOutputs[1].right_elevator_damping_mode);
-  idRightElevatorCommandedPosition[0]->set(elacsAnalogOutputs[0].right_elev_pos_order_deg + secsAnalogOutputs[0].right_elev_pos_order_deg);
+  idRightElevatorCommandedPosition[0]->set(interpolateCommand(elacsAnalogOutputsPrevious[0].right_elev_pos_order_deg +
+                                                              secsAnalogOutputsPrevious[0].right_elev_pos_order_deg,
+                                                              elacsAnalogOutputs[0].right_elev_pos_order_deg +
+                                                              secsAnalogOutputs[0].right_elev_pos_order_deg));
   idLeftElevatorSolenoidEnergized[1]->set(elacsDiscreteOutputs[0].left_elevator_damping_mode ||
                                           secsDiscreteOutputs[0].left_elevator_damping_mode);
-  idLeftElevatorCommandedPosition[1]->set(elacsAnalogOutputs[1].left_elev_pos_order_deg + secsAnalogOutputs[1].left_elev_pos_order_deg);
+  idLeftElevatorCommandedPosition[1]->set(interpolateCommand(elacsAnalogOutputsPrevious[1].left_elev_pos_order_deg +
+                                                             secsAnalogOutputsPrevious[1].left_elev_pos_order_deg,
+                                                             elacsAnalogOutputs[1].left_elev_pos_order_deg +
+                                                             secsAnalogOutputs[1].left_elev_pos_order_deg));
   idRightElevatorSolenoidEnergized[1]->set(elacsDiscreteOutputs[0].right_elevator_damping_mode ||
                                            secsDiscreteOutputs[0].right_elevator_damping_mode);
-  idRightElevatorCommandedPosition[1]->set(elacsAnalogOutputs[1].right_elev_pos_order_deg + secsAnalogOutputs[1].right_elev_pos_order_deg);
+  idRightElevatorCommandedPosition[1]->set(interpolateCommand(elacsAnalogOutputsPrevious[1].right_elev_pos_order_deg +
+                                                              secsAnalogOutputsPrevious[1].right_elev_pos_order_deg,
+                                                              elacsAnalogOutputs[1].right_elev_pos_order_deg +
+                                                              secsAnalogOutputs[1].right_elev_pos_order_deg));
 
   idTHSActiveModeCommanded[0]->set(elacsDiscreteOutputs[1].ths_active);
-  idTHSCommandedPosition[0]->set(-elacsAnalogOutputs[1].ths_pos_order);
+  idTHSCommandedPosition[0]->set(interpolateCommand(-elacsAnalogOutputsPrevious[1].ths_pos_order, -elacsAnalogOutputs[1].ths_pos_order));
   idTHSActiveModeCommanded[1]->set(elacsDiscreteOutputs[0].ths_active || secsDiscreteOutputs[0].ths_active);
-  idTHSCommandedPosition[1]->set(-elacsAnalogOutputs[0].ths_pos_order - secsAnalogOutputs[0].ths_pos_order_deg);
+  idTHSCommandedPosition[1]->set(interpolateCommand(-elacsAnalogOutputsPrevious[0].ths_pos_order -
+                                                        secsAnalogOutputsPrevious[0].ths_pos_order_deg,
+                                                    -elacsAnalogOutputs[0].ths_pos_order - secsAnalogOutputs[0].ths_pos_order_deg));
   idTHSActiveModeCommanded[2]->set(secsDiscreteOutputs[1].ths_active);
-  idTHSCommandedPosition[2]->set(-secsAnalogOutputs[1].ths_pos_order_deg);
+  idTHSCommandedPosition[2]->set(interpolateCommand(-secsAnalogOutputsPrevious[1].ths_pos_order_deg,
+                                                    -secsAnalogOutputs[1].ths_pos_order_deg));
 
   idYawDamperSolenoidEnergized[0]->set(facsDiscreteOutputs[0].yaw_damper_engaged);
-  idYawDamperCommandedPosition[0]->set(facsAnalogOutputs[0].yaw_damper_order_deg);
+  idYawDamperCommandedPosition[0]->set(interpolateCommand(facsAnalogOutputsPrevious[0].yaw_damper_order_deg,
+                                                          facsAnalogOutputs[0].yaw_damper_order_deg));
   idYawDamperSolenoidEnergized[1]->set(facsDiscreteOutputs[1].yaw_damper_engaged);
-  idYawDamperCommandedPosition[1]->set(facsAnalogOutputs[1].yaw_damper_order_deg);
+  idYawDamperCommandedPosition[1]->set(interpolateCommand(facsAnalogOutputsPrevious[1].yaw_damper_order_deg,
+                                                          facsAnalogOutputs[1].yaw_damper_order_deg));
   idRudderTrimActiveModeCommanded[0]->set(facsDiscreteOutputs[0].rudder_trim_engaged);
-  idRudderTrimCommandedPosition[0]->set(facsAnalogOutputs[0].rudder_trim_order_deg);
+  idRudderTrimCommandedPosition[0]->set(interpolateCommand(facsAnalogOutputsPrevious[0].rudder_trim_order_deg,
+                                                           facsAnalogOutputs[0].rudder_trim_order_deg));
   idRudderTrimActiveModeCommanded[1]->set(facsDiscreteOutputs[1].rudder_trim_engaged);
-  idRudderTrimCommandedPosition[1]->set(facsAnalogOutputs[1].rudder_trim_order_deg);
+  idRudderTrimCommandedPosition[1]->set(interpolateCommand(facsAnalogOutputsPrevious[1].rudder_trim_order_deg,
+                                                           facsAnalogOutputs[1].rudder_trim_order_deg));
   idRudderTravelLimitActiveModeCommanded[0]->set(facsDiscreteOutputs[0].rudder_travel_lim_engaged);
-  idRudderTravelLimCommandedPosition[0]->set(facsAnalogOutputs[0].rudder_travel_limit_order_deg);
+  idRudderTravelLimCommandedPosition[0]->set(interpolateCommand(facsAnalogOutputsPrevious[0].rudder_travel_limit_order_deg,
+                                                                facsAnalogOutputs[0].rudder_travel_limit_order_deg));
   idRudderTravelLimitActiveModeCommanded[1]->set(facsDiscreteOutputs[1].rudder_travel_lim_engaged);
-  idRudderTravelLimCommandedPosition[1]->set(facsAnalogOutputs[1].rudder_travel_limit_order_deg);
+  idRudderTravelLimCommandedPosition[1]->set(interpolateCommand(facsAnalogOutputsPrevious[1].rudder_travel_limit_order_deg,
+                                                                facsAnalogOutputs[1].rudder_travel_limit_order_deg));
 
   double totalSpoilersLeftDeflection = idLeftSpoilerPosition[0]->get() + idLeftSpoilerPosition[1]->get() + idLeftSpoilerPosition[2]->get() +
                                        idLeftSpoilerPosition[3]->get() + idLeftSpoilerPosition[4]->get();
@@ -5,6 +5,7 @@
 
 #include "AdditionalData.h"
 #include "Arinc429.h"
+#include "Arinc429Codec.h"
 #include "AutopilotLaws.h"
 #include "AutopilotStateMachine.h"
 #include "Autothrust.h"
@@ -13,6 +14,7 @@
 #include "FlightDataRecorder.h"
 #include "InterpolatingLookupTable.h"
 #include "LocalVariable.h"
+#include "ModelRateGroup.h"
 #include "RateLimiter.h"
 #include "SimConnectInterface.h"
 #include "SpoilersHandler.h"
@@ -65,6 +67,11 @@ class FlyByWireInterface {
   bool autoThrustEnabled = false;
   bool tailstrikeProtectionEnabled = true;
 
+  double autopilotRate = 0;
+  double flightControlsRate = 0;
+  ModelRateGroup autopilotRateGroup;
+  ModelRateGroup flightControlsRateGroup;
+
   ConfirmNode elac2EmerPowersupplyRelayTimer = ConfirmNode(true, 30);
   SRFlipFlop elac2EmerPowersupplyNoseGearConditionLatch = SRFlipFlop(true);
 
@@ -142,11 +149,13 @@ class FlyByWireInterface {
   Elac elacs[2] = {Elac(true), Elac(false)};
   base_elac_discrete_outputs elacsDiscreteOutputs[2] = {};
   base_elac_analog_outputs elacsAnalogOutputs[2] = {};
+  base_elac_analog_outputs elacsAnalogOutputsPrevious[2] = {};
   base_elac_out_bus elacsBusOutputs[2] = {};
 
   Sec secs[3] = {Sec(true, false), Sec(false, false), Sec(false, true)};
   base_sec_discrete_outputs secsDiscreteOutputs[3] = {};
   base_sec_analog_outputs secsAnalogOutputs[3] = {};
+  base_sec_analog_outputs secsAnalogOutputsPrevious[3] = {};
   base_sec_out_bus secsBusOutputs[3] = {};
 
   Fcdc fcdcs[2] = {Fcdc(true), Fcdc(false)};
@@ -156,6 +165,7 @@ class FlyByWireInterface {
   Fac facs[2] = {Fac(true), Fac(false)};
   base_fac_discrete_outputs facsDiscreteOutputs[2] = {};
   base_fac_analog_outputs facsAnalogOutputs[2] = {};
+  base_fac_analog_outputs facsAnalogOutputsPrevious[2] = {};
   base_fac_bus facsBusOutputs[2] = {};
 
   InterpolatingLookupTable throttleLookupTable;
@@ -301,7 +311,8 @@ class FlyByWireInterface {
   std::unique_ptr<LocalVariable> idAutothrustDisconnect;
   std::unique_ptr<LocalVariable> idThrottlePosition3d_1;
   std::unique_ptr<LocalVariable> idThrottlePosition3d_2;
-  InterpolatingLookupTable idThrottlePositionLookupTable3d;
+  static constexpr FixedInterpolatingLookupTable<5> idThrottlePositionLookupTable3d{
+      {{-20.0, 0.0}, {0.0, 25.0}, {25.0, 50.0}, {35.0, 75.0}, {45.0, 100.0}}, 0, 100};
 
   std::vector<std::shared_ptr<ThrottleAxisMapping>> throttleAxis;
 
@@ -463,6 +474,8 @@ class FlyByWireInterface {
   std::unique_ptr<LocalVariable> idFcdcSpoilerRight3Pos[2];
   std::unique_ptr<LocalVariable> idFcdcSpoilerRight4Pos[2];
   std::unique_ptr<LocalVariable> idFcdcSpoilerRight5Pos[2];
+  // FCDC bus output Lvars in the order of the words of the bus
+  LocalVariable* fcdcBusVariables[2][Arinc429Codec::wordCount<base_fcdc_bus>()] = {};
 
   // FCDC discrete output Lvars
   std::unique_ptr<LocalVariable> idFcdcPriorityCaptGreen[2];
@@ -612,7 +625,10 @@ class FlyByWireInterface {
 
   bool updateFac(double sampleTime, int facIndex);
 
+  void resetModelRateGroups();
+
   bool updateServoSolenoidStatus();
+  double interpolateCommand(double previous, double current);
 
   bool updateSpoilers(double sampleTime);
 
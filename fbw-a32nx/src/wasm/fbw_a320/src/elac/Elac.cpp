@@ -30,13 +30,34 @@ void Elac::initSelfTests(bool viaPushButton) {
 
 // Main update cycle. Surface position through parameters here is temporary.
 void Elac::update(double deltaTime, double simulationTime, bool faultActive, bool isPowered) {
+  if (updateMonitoring(deltaTime, faultActive, isPowered)) {
+    updateModel();
+  }
+}
+
+// Update the power supply, self-test and health monitoring.
+// Returns false if a model step would be a no-op, i.e. the model has already been stopped and the computer
+// was not running in the last cycle. In this case, only the monitoring inputs need to be provided, and the
+// outputs are the constant failure set.
+bool Elac::updateMonitoring(double deltaTime, bool faultActive, bool isPowered) {
   monitorPowerSupply(deltaTime, isPowered);
   monitorButtonStatus();
 
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
+  if (modelStopped && !modelInputs.in.sim_data.computer_running) {
+    modelInputs.in.sim_data.computer_running = monitoringHealthy;
+    return false;
+  }
+
+  return true;
+}
+
+// Step the model. The model sees the computer running state of the previous cycle.
+void Elac::updateModel() {
   elacComputer.setExternalInputs(&modelInputs);
+  modelStopped = !modelInputs.in.sim_data.computer_running;
   modelInputs.in.sim_data.computer_running = monitoringHealthy;
   elacComputer.step();
   modelOutputs = elacComputer.getExternalOutputs().out;
@@ -17,6 +17,10 @@ class Elac {
 
   void update(double deltaTime, double simulationTime, bool faultActive, bool isPowered);
 
+  bool updateMonitoring(double deltaTime, bool faultActive, bool isPowered);
+
+  void updateModel();
+
   base_elac_out_bus getBusOutputs();
 
   base_elac_discrete_outputs getDiscreteOutputs();
@@ -42,6 +46,9 @@ class Elac {
   ElacComputer elacComputer;
   elac_outputs modelOutputs;
 
+  // The model was last stepped with the computer not running, so further steps are no-ops until it runs again.
+  bool modelStopped = true;
+
   // Computer Self-monitoring vars
   bool monitoringHealthy;
 
@@ -13,16 +13,30 @@ void Fac::clearMemory() {}
 
 // Main update cycle. Surface position through parameters here is temporary.
 void Fac::update(double deltaTime, double simulationTime, bool faultActive, bool isPowered) {
+  if (updateMonitoring(deltaTime, faultActive, isPowered)) {
+    updateModel();
+  }
+}
+
+// Update the power supply, self-test and health monitoring.
+// Returns false if the program execution is stopped by a power failure, or if a model step would be a no-op,
+// i.e. the model has already been stopped and the FAC is still not healthy. In this case, only the monitoring
+// inputs need to be provided, and the outputs are the constant failure set.
+bool Fac::updateMonitoring(double deltaTime, bool faultActive, bool isPowered) {
   monitorPowerSupply(deltaTime, isPowered);
 
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  if (!shortPowerFailure) {
-    facComputer.setExternalInputs(&modelInputs);
-    facComputer.step();
-    modelOutputs = facComputer.getExternalOutputs().out;
-  }
+  return !shortPowerFailure && (!modelStopped || modelInputs.in.sim_data.computer_running);
+}
+
+// Step the model.
+void Fac::updateModel() {
+  facComputer.setExternalInputs(&modelInputs);
+  modelStopped = !modelInputs.in.sim_data.computer_running;
+  facComputer.step();
+  modelOutputs = facComputer.getExternalOutputs().out;
 }
 
 // Software reset logic. After a reset, start self-test if on ground and engines off, and reset RAM.
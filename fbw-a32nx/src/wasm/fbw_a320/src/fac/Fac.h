@@ -14,6 +14,10 @@ class Fac {
 
   void update(double deltaTime, double simulationTime, bool faultActive, bool isPowered);
 
+  bool updateMonitoring(double deltaTime, bool faultActive, bool isPowered);
+
+  void updateModel();
+
   base_fac_bus getBusOutputs();
 
   base_fac_discrete_outputs getDiscreteOutputs();
@@ -37,6 +41,9 @@ class Fac {
   FacComputer facComputer;
   fac_outputs modelOutputs;
 
+  // The model was last stepped with the computer not running, so further steps are no-ops until it runs again.
+  bool modelStopped = true;
+
   // Computer Self-monitoring vars
   bool facHealthy;
 
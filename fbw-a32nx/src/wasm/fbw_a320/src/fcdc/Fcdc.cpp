@@ -22,17 +22,29 @@ void Fcdc::startup() {
 
 // Main update cycle
 void Fcdc::update(double deltaTime, bool faultActive, bool isPowered) {
+  if (updateMonitoring(deltaTime, faultActive, isPowered)) {
+    updateModel(deltaTime);
+  }
+}
+
+// Update the power supply, self-test and health monitoring.
+// Returns false if the computer is not healthy. In this case, only the discrete inputs used by the startup
+// sequence need to be provided, and the outputs are the constant failure set.
+bool Fcdc::updateMonitoring(double deltaTime, bool faultActive, bool isPowered) {
   monitorPowerSupply(deltaTime, isPowered);
 
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  if (monitoringHealthy) {
-    computeComputerEngagements();
-    computeActiveSystemLaws();
-    consolidatePositionData();
-    computeSidestickPriorityLights(deltaTime);
-  }
+  return monitoringHealthy;
+}
+
+// Perform the data concentration and computations.
+void Fcdc::updateModel(double deltaTime) {
+  computeComputerEngagements();
+  computeActiveSystemLaws();
+  consolidatePositionData();
+  computeSidestickPriorityLights(deltaTime);
 }
 
 // Perform self monitoring
@@ -10,6 +10,10 @@ class Fcdc {
 
   void update(double deltaTime, bool faultActive, bool isPowered);
 
+  bool updateMonitoring(double deltaTime, bool faultActive, bool isPowered);
+
+  void updateModel(double deltaTime);
+
   FcdcBus getBusOutputs();
 
   FcdcDiscreteOutputs getDiscreteOutputs();
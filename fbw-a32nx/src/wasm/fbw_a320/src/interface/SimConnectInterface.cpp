@@ -4,13 +4,6 @@
 #include <map>
 #include <vector>
 
-// remove when aileron events can be processed via SimConnect
-bool SimConnectInterface::loggingFlightControlsEnabled = false;
-// remove when aileron events can be processed via SimConnect
-SimInput SimConnectInterface::simInput = {};
-// remove when aileron events can be processed via SimConnect
-double SimConnectInterface::flightControlsKeyChangeAileron = 0.0;
-
 bool SimConnectInterface::connect(bool clientDataEnabled,
                                   bool autopilotStateMachineEnabled,
                                   bool autopilotLawsEnabled,
@@ -79,7 +72,7 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     }
     // register key event handler
     // remove when aileron events can be processed via SimConnect
-    register_key_event_handler_EX1(static_cast<GAUGE_KEY_EVENT_HANDLER_EX1>(processKeyEvent), NULL);
+    register_key_event_handler_EX1(static_cast<GAUGE_KEY_EVENT_HANDLER_EX1>(processKeyEvent), this);
     // register for pause event
     SimConnect_SubscribeToSystemEvent(hSimConnect, Events::SYSTEM_EVENT_PAUSE, "Pause_EX1");
     // send initial event to FCU to force HDG mode
@@ -95,7 +88,7 @@ void SimConnectInterface::disconnect() {
   if (isConnected) {
     // unregister key event handler
     // remove when aileron events can be processed via SimConnect
-    unregister_key_event_handler_EX1(static_cast<GAUGE_KEY_EVENT_HANDLER_EX1>(processKeyEvent), NULL);
+    unregister_key_event_handler_EX1(static_cast<GAUGE_KEY_EVENT_HANDLER_EX1>(processKeyEvent), this);
     // unregister from pause events
     SimConnect_UnsubscribeFromSystemEvent(hSimConnect, Events::SYSTEM_EVENT_PAUSE);
     // info message
@@ -1398,25 +1391,30 @@ void SimConnectInterface::processKeyEvent(ID32 event,
                                           UINT32 evdata3,
                                           UINT32 evdata4,
                                           PVOID userdata) {
+  // the handler is registered with the owning instance as user data
+  auto* self = static_cast<SimConnectInterface*>(userdata);
+
   switch (event) {
     case KEY_AILERON_LEFT: {
-      simInput.inputs[AXIS_AILERONS_SET] = std::fmin(1.0, simInput.inputs[AXIS_AILERONS_SET] + flightControlsKeyChangeAileron);
-      if (loggingFlightControlsEnabled) {
+      self->simInput.inputs[AXIS_AILERONS_SET] =
+          std::fmin(1.0, self->simInput.inputs[AXIS_AILERONS_SET] + self->flightControlsKeyChangeAileron);
+      if (self->loggingFlightControlsEnabled) {
         std::cout << "WASM: AILERONS_LEFT: ";
         std::cout << "(no data)";
         std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_AILERONS_SET];
+        std::cout << self->simInput.inputs[AXIS_AILERONS_SET];
         std::cout << std::endl;
       }
       break;
     }
     case KEY_AILERON_RIGHT: {
-      simInput.inputs[AXIS_AILERONS_SET] = std::fmax(-1.0, simInput.inputs[AXIS_AILERONS_SET] - flightControlsKeyChangeAileron);
-      if (loggingFlightControlsEnabled) {
+      self->simInput.inputs[AXIS_AILERONS_SET] =
+          std::fmax(-1.0, self->simInput.inputs[AXIS_AILERONS_SET] - self->flightControlsKeyChangeAileron);
+      if (self->loggingFlightControlsEnabled) {
         std::cout << "WASM: AILERONS_RIGHT: ";
         std::cout << "(no data)";
         std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_AILERONS_SET];
+        std::cout << self->simInput.inputs[AXIS_AILERONS_SET];
         std::cout << std::endl;
       }
       break;
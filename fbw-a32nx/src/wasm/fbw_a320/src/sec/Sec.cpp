@@ -27,12 +27,28 @@ void Sec::clearMemory() {}
 
 // Main update cycle. Surface position through parameters here is temporary.
 void Sec::update(double deltaTime, double simulationTime, bool faultActive, bool isPowered) {
+  if (updateMonitoring(deltaTime, faultActive, isPowered)) {
+    updateModel();
+  }
+}
+
+// Update the power supply, self-test and health monitoring.
+// Returns false if a model step would be a no-op, i.e. the model has already been stopped and the computer
+// is still not running. In this case, only the monitoring inputs need to be provided, and the outputs are
+// the constant failure set.
+bool Sec::updateMonitoring(double deltaTime, bool faultActive, bool isPowered) {
   monitorPowerSupply(deltaTime, isPowered);
 
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
+  return !modelStopped || modelInputs.in.sim_data.computer_running;
+}
+
+// Step the model.
+void Sec::updateModel() {
   secComputer.setExternalInputs(&modelInputs);
+  modelStopped = !modelInputs.in.sim_data.computer_running;
   secComputer.step();
   modelOutputs = secComputer.getExternalOutputs().out;
 }
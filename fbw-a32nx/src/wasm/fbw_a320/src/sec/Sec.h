@@ -16,6 +16,10 @@ class Sec {
 
   void update(double deltaTime, double simulationTime, bool faultActive, bool isPowered);
 
+  bool updateMonitoring(double deltaTime, bool faultActive, bool isPowered);
+
+  void updateModel();
+
   base_sec_out_bus getBusOutputs();
 
   base_sec_discrete_outputs getDiscreteOutputs();
@@ -39,6 +43,9 @@ class Sec {
   SecComputer secComputer;
   sec_outputs modelOutputs;
 
+  // The model was last stepped with the computer not running, so further steps are no-ops until it runs again.
+  bool modelStopped = true;
+
   // Computer Self-monitoring vars
   bool monitoringHealthy;
 
@@ -9,6 +9,7 @@
 
 #include "EngineControl_A380X.h"
 #include "EngineRatios.hpp"
+#include "Fadec.h"
 #include "Polynomials_A380X.hpp"
 #include "Table1502_A380X.hpp"
 #include "ThrustLimits_A380X.hpp"
@@ -837,8 +838,8 @@ void EngineControl_A380X::updateFuel(double deltaTimeSeconds) {
   }
 
   // Will save the current fuel quantities if on the ground AND engines being shutdown
-  // AND 5 seconds have passed since the last save
-  if (msfsHandlerPtr->getSimOnGround() && (msfsHandlerPtr->getSimulationTime() - lastFuelSaveTime) > 5.0 &&
+  // AND they have changed - the fuel configuration limits this to one save every few seconds
+  if (msfsHandlerPtr->getSimOnGround() &&
       (engine1State == OFF || engine1State == SHUTTING ||  // 1
        engine2State == OFF || engine2State == SHUTTING ||  // 2
        engine3State == OFF || engine3State == SHUTTING ||  // 3
@@ -855,8 +856,7 @@ void EngineControl_A380X::updateFuel(double deltaTimeSeconds) {
     fuelConfiguration.setFuelFeedFourGallons(simData.fuelFeedTankDataPtr->data().fuelSystemFeedFour);
     fuelConfiguration.setFuelRightOuterGallons(simData.fuelTankDataPtr->data().fuelSystemRightOuter);
     fuelConfiguration.setFuelTrimGallons(simData.fuelTankDataPtr->data().fuelSystemTrim);
-    fuelConfiguration.saveConfigurationToIni();
-    lastFuelSaveTime = msfsHandlerPtr->getSimulationTime();
+    fuelConfiguration.saveConfigurationToIniIfChanged(msfsHandlerPtr->getSimulationTime());
   }
 
 #ifdef PROFILING
@@ -864,14 +864,14 @@ void EngineControl_A380X::updateFuel(double deltaTimeSeconds) {
 #endif
 }
 
-void EngineControl_A380X::updateThrustLimits(double simulationTime,
-                                             double pressureAltitude,
-                                             double ambientTemperature,
-                                             double ambientPressure,
-                                             double mach,
-                                             int    packs,
-                                             int    nai,
-                                             int    wai) {
+void EngineControl_A380X::updateThrustLimits(double                  simulationTime,
+                                             double                  pressureAltitude,
+                                             double                  ambientTemperature,
+                                             [[maybe_unused]] double ambientPressure,
+                                             double                  mach,
+                                             int                     packs,
+                                             int                     nai,
+                                             int                     wai) {
 #ifdef PROFILING
   profilerUpdateThrustLimits.start();
 #endif
@@ -880,17 +880,13 @@ void EngineControl_A380X::updateThrustLimits(double simulationTime,
   const double pressAltitude = simData.simVarsDataPtr->data().pressureAltitude;
 
   // Write all N1 Limits
-  const double altitude = (std::min)(16600.0, pressAltitude);
-  const double to       = ThrustLimits_A380X::limitN1(0, altitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  const double ga       = ThrustLimits_A380X::limitN1(1, altitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  double       flex_to  = 0;
-  double       flex_ga  = 0;
-  if (flexTemp > 0) {
-    flex_to = ThrustLimits_A380X::limitN1(0, altitude, ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
-    flex_ga = ThrustLimits_A380X::limitN1(1, altitude, ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
-  }
-  double clb = ThrustLimits_A380X::limitN1(2, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  double mct = ThrustLimits_A380X::limitN1(3, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  const auto   limits  = thrustLimitCache.get(pressAltitude, ambientTemperature, flexTemp, packs, nai, wai);
+  const double to      = limits.to;
+  const double ga      = limits.ga;
+  const double flex_to = limits.flexTo;
+  const double flex_ga = limits.flexGa;
+  double       clb     = limits.clb;
+  double       mct     = limits.mct;
 
   // transition between TO and GA limit -----------------------------------------------------------------------------
   const double machFactorLow = (std::max)(0.0, (std::min)(1.0, (mach - 0.04) / 0.04));
@@ -8,6 +8,8 @@
 
 #include "FadecSimData_A380X.hpp"
 #include "FuelConfiguration_A380X.h"
+#include "ThrustLimitCache.hpp"
+#include "ThrustLimits_A380X.hpp"
 
 #define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
 #define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
@@ -39,10 +41,6 @@ class EngineControl_A380X {
   // Fuel configuration for loading and storing fuel levels
   FuelConfiguration_A380X fuelConfiguration{};
 
-  // Remember last fuel save time to allow saving fuel only every 5 seconds
-  FLOAT64                 lastFuelSaveTime   = 0;
-  static constexpr double FUEL_SAVE_INTERVAL = 5.0;  // seconds
-
   // thrust limits transition for flex
   bool                    isTransitionActive   = false;
   static constexpr double TRANSITION_WAIT_TIME = 10;
@@ -56,6 +54,9 @@ class EngineControl_A380X {
   double transitionStartTime;
   double transitionFactor;
 
+  // N1 limits, only recomputed when the altitude/temperature band or the configuration changes
+  ThrustLimitCache<ThrustLimits_A380X> thrustLimitCache{};
+
   // TODO - might not be required - feeds into stateMachine but really relevant
   double prevSimEngineN3[4] = {0.0, 0.0, 0.0, 0.0};
 
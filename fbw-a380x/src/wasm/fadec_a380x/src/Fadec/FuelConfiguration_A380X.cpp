@@ -1,6 +1,7 @@
 // Copyright (c) 2023-2024 FlyByWire Simulations
 // SPDX-License-Identifier: GPL-3.0
 
+#include <cmath>
 #include <iostream>
 #include <string>
 
@@ -14,12 +15,14 @@
 void FuelConfiguration_A380X::loadConfigurationFromIni() {
   LOG_INFO("Fadec::FuelConfiguration: loading configuration file " + configFilename);
 
-  mINI::INIStructure ini;
   mINI::INIFile iniFile(configFilename);
 
   if (!iniFile.read(ini)) {
     LOG_ERROR("Fadec::FuelConfiguration_A380X: failed to read configuration file " + configFilename + " due to error \"" + strerror(errno) +
               "\" -> using default fuel quantities.");
+    // the next save must create the file from scratch, whatever the reader left in the structure
+    ini.clear();
+    iniFileExists = false;
     return;
   }
 
@@ -35,6 +38,10 @@ void FuelConfiguration_A380X::loadConfigurationFromIni() {
   fuelRightOuterGallons = mINI::INITypeConversion::getDouble(ini, INI_SECTION_FUEL, INI_SECTION_FUEL_RIGHT_OUTER_QTY, fuelRightOuterDefault);
   fuelTrimGallons       = mINI::INITypeConversion::getDouble(ini, INI_SECTION_FUEL, INI_SECTION_FUEL_TRIM_QTY, fuelTrimDefault);
 
+  iniFileExists      = true;
+  savedQuantities    = getQuantities();
+  hasSavedQuantities = true;
+
   LOG_DEBUG("Fadec::FuelConfiguration_A380X: loaded fuel configuration from " + configFilename + " with the following values:");
   LOG_DEBUG("Fadec::FuelConfiguration_A380X: " + this->toString());
 }
@@ -42,12 +49,8 @@ void FuelConfiguration_A380X::loadConfigurationFromIni() {
 void FuelConfiguration_A380X::saveConfigurationToIni() {
   LOG_DEBUG("Fadec::FuelConfiguration_A380X: saving configuration file " + configFilename);
 
-  mINI::INIStructure ini;
   mINI::INIFile iniFile(configFilename);
 
-  // Do not check a possible error since the file may not exist yet
-  iniFile.read(ini);
-
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_LEFT_OUTER_QTY]  = std::to_string(this->fuelLeftOuterGallons);
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_FEED_ONE_QTY]    = std::to_string(this->fuelFeedOneGallons);
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_LEFT_MID_QTY]    = std::to_string(this->fuelLeftMidGallons);
@@ -60,15 +63,44 @@ void FuelConfiguration_A380X::saveConfigurationToIni() {
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_RIGHT_OUTER_QTY] = std::to_string(this->fuelRightOuterGallons);
   ini[INI_SECTION_FUEL][INI_SECTION_FUEL_TRIM_QTY]        = std::to_string(this->fuelTrimGallons);
 
-  if (!iniFile.write(ini, true)) {
+  // Once the file has been read, the in-memory structure holds all of its contents and can simply be written out.
+  // Otherwise the file may not exist yet or still contain other sections, which write() creates or merges.
+  const bool written = iniFileExists ? iniFile.generate(ini, true) : iniFile.write(ini, true);
+  if (!written) {
     LOG_ERROR("Fadec::FuelConfiguration_A380X: failed to write engine conf " + configFilename + " due to error \"" + strerror(errno) + "\"");
     return;
   }
 
+  iniFileExists      = true;
+  savedQuantities    = getQuantities();
+  hasSavedQuantities = true;
+
   LOG_DEBUG("Fadec::FuelConfiguration_A380X: saved fuel configuration to " + configFilename + " with the following values:");
   LOG_DEBUG("Fadec::FuelConfiguration_A380X: " + this->toString());
 }
 
+void FuelConfiguration_A380X::saveConfigurationToIniIfChanged(double simulationTime) {
+  if (simulationTime - lastSaveTime <= SAVE_INTERVAL || !hasChangedSinceSave()) {
+    return;
+  }
+  // also on failure, to not retry writing the file every frame
+  lastSaveTime = simulationTime;
+  saveConfigurationToIni();
+}
+
+bool FuelConfiguration_A380X::hasChangedSinceSave() const {
+  if (!hasSavedQuantities) {
+    return true;
+  }
+  const std::array<double, 11> quantities = getQuantities();
+  for (std::size_t i = 0; i < quantities.size(); i++) {
+    if (std::abs(quantities[i] - savedQuantities[i]) > SAVE_THRESHOLD) {
+      return true;
+    }
+  }
+  return false;
+}
+
 std::string FuelConfiguration_A380X::toString() const {
   std::ostringstream oss;
   oss << "FuelConfiguration_A380X { " << "\n"
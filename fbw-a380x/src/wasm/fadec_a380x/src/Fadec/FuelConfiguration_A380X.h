@@ -4,8 +4,11 @@
 #ifndef FLYBYWIRE_AIRCRAFT_FUELCONFIGURATION_A380X_H
 #define FLYBYWIRE_AIRCRAFT_FUELCONFIGURATION_A380X_H
 
+#include <array>
 #include <string>
 
+#include "inih/ini.h"
+
 #define INI_SECTION_FUEL "FUEL"
 #define INI_SECTION_FUEL_LEFT_OUTER_QTY "FUEL_LEFT_OUTER_QTY"
 #define INI_SECTION_FUEL_FEED_ONE_QTY "FUEL_FEED_ONE_QTY"
@@ -25,6 +28,9 @@
  *
  * This class provides methods to load and save the fuel configuration from/to an INI file.
  * It also provides getter and setter methods for each fuel tank quantity.
+ *
+ * The parsed INI file is kept in memory after loading, so saving does not need to read the file again. Periodic saves
+ * should use saveConfigurationToIniIfChanged() which only writes the file if a tank quantity has changed noticeably.
  */
 class FuelConfiguration_A380X {
   // Fuel tank default quantities in gallons
@@ -56,8 +62,37 @@ class FuelConfiguration_A380X {
   double fuelFeedFourGallons;
   double fuelTrimGallons;
 
+  // Minimum change of a tank quantity in gallons before the configuration is saved again
+  static constexpr double SAVE_THRESHOLD = 0.1;
+  // Minimum time between two saves in seconds
+  static constexpr double SAVE_INTERVAL = 5.0;
+
+  // Tank quantities in gallons when the configuration was last loaded or saved, unset until then
+  std::array<double, 11> savedQuantities{};
+  bool                   hasSavedQuantities = false;
+  double                 lastSaveTime       = 0.0;
+
+  // Contents of the INI file as last loaded or saved
+  mINI::INIStructure ini;
+  bool               iniFileExists = false;
+
   std::string configFilename{"A380X-default-fuel-config.ini"};
 
+  /**
+   * @brief Returns the current tank quantities in gallons in the order of savedQuantities.
+   */
+  std::array<double, 11> getQuantities() const {
+    return {fuelLeftOuterGallons, fuelFeedOneGallons,    fuelLeftMidGallons,    fuelLeftInnerGallons,
+            fuelFeedTwoGallons,   fuelFeedThreeGallons,  fuelRightInnerGallons, fuelRightMidGallons,
+            fuelFeedFourGallons,  fuelRightOuterGallons, fuelTrimGallons};
+  }
+
+  /**
+   * @brief Checks if nothing has been loaded or saved yet or any tank quantity differs from the last loaded or saved one
+   * by more than SAVE_THRESHOLD.
+   */
+  bool hasChangedSinceSave() const;
+
  public:
 
   /**
@@ -91,6 +126,16 @@ class FuelConfiguration_A380X {
    */
   void saveConfigurationToIni();
 
+  /**
+   * @brief Saves the current fuel configuration to an INI file if it has changed since the last save.
+   *
+   * The file is only written if a tank quantity changed by more than SAVE_THRESHOLD gallons and at least
+   * SAVE_INTERVAL seconds have passed since the last save, so this can be called every frame.
+   *
+   * @param simulationTime The current simulation time in seconds.
+   */
+  void saveConfigurationToIniIfChanged(double simulationTime);
+
  public:
   double getFuelFeedOneGallons() const { return fuelFeedOneGallons; }
   double getFuelLeftOuterGallons() const { return fuelLeftOuterGallons; }
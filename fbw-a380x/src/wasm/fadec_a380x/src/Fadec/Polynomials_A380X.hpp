@@ -3,6 +3,8 @@
 
 #include <cmath>
 
+#include "Horner.hpp"
+
 /**
  * @class Polynomial
  * @brief A collection of multi-variate regression polynomials for engine parameters.
@@ -53,10 +55,7 @@ class Polynomial_A380X {
     };
 
     // Calculate the N3 value during engine startup using a polynomial model
-    double outN3 = 0;
-    for (int i = 0; i < 16; i++) {
-      outN3 += coefficients[i] * (std::pow)(normalizedN3, i);
-    }
+    double outN3 = Horner::evaluate(coefficients, normalizedN3);
     outN3 *= currentSimN3;
 
     // Ensure the calculated N3 value is within the expected range
@@ -98,11 +97,8 @@ class Polynomial_A380X {
 
     // Calculate the N1 value during engine startup using a polynomial model
     double normalN1pre =
-        (-2.4698087 * (std::pow)(normalizedN3, 3)) + (0.9662026 * (std::pow)(normalizedN3, 2)) + (0.0701367 * normalizedN3);
-    double normalN1post = 0;
-    for (int i = 0; i < 9; i++) {
-      normalN1post += coefficients[i] * (std::pow)(normalizedN3, i);
-    }
+        (-2.4698087 * normalizedN3 * normalizedN3 * normalizedN3) + (0.9662026 * normalizedN3 * normalizedN3) + (0.0701367 * normalizedN3);
+    double normalN1post = Horner::evaluate(coefficients, normalizedN3);
 
     // Return the calculated N1 value
     if (normalN1post >= normalN1pre) {
@@ -142,9 +138,7 @@ class Polynomial_A380X {
 
     // Calculate the normalized Fuel Flow value using a polynomial model if the normalized N3 value is greater than 0.37
     if (normalizedN3 > 0.37) {
-      for (int i = 0; i < 9; i++) {
-        normalizedFF += coefficients[i] * (std::pow)(normalizedN3, i);
-      }
+      normalizedFF = Horner::evaluate(coefficients, normalizedN3);
     }
 
     // Ensure the calculated normalized Fuel Flow value is non-negative
@@ -190,9 +184,7 @@ class Polynomial_A380X {
       };
 
       // Calculate the normalized EGT value using a polynomial model
-      for (int i = 0; i < 9; i++) {
-        normalizedEGT += egtCoefficients[i] * (std::pow)(normalizedN3, i);
-      }
+      normalizedEGT = Horner::evaluate(egtCoefficients, normalizedN3);
     }
 
     // Calculate and return the EGT value
@@ -305,23 +297,12 @@ class Polynomial_A380X {
         1.9312e-08    // coefficient for x^15
     };
 
-    // Calculate and return the Corrected EGT value using a polynomial model
-    return c_EGT[0]                             //
-           + c_EGT[1]                           //
-           + (c_EGT[2] * cn1)                   //
-           + (c_EGT[3] * cff)                   //
-           + (c_EGT[4] * mach)                  //
-           + (c_EGT[5] * alt)                   //
-           + (c_EGT[6] * (std::pow)(cn1, 2))    //
-           + (c_EGT[7] * cn1 * cff)             //
-           + (c_EGT[8] * cn1 * mach)            //
-           + (c_EGT[9] * cn1 * alt)             //
-           + (c_EGT[10] * (std::pow)(cff, 2))   //
-           + (c_EGT[11] * mach * cff)           //
-           + (c_EGT[12] * cff * alt)            //
-           + (c_EGT[13] * (std::pow)(mach, 2))  //
-           + (c_EGT[14] * mach * alt)           //
-           + (c_EGT[15] * (std::pow)(alt, 2));  //
+    // Calculate and return the Corrected EGT value using a polynomial model, with the terms grouped by variable
+    return c_EGT[0] + c_EGT[1]                                                                              //
+           + cn1 * (c_EGT[2] + (c_EGT[6] * cn1) + (c_EGT[7] * cff) + (c_EGT[8] * mach) + (c_EGT[9] * alt))  //
+           + cff * (c_EGT[3] + (c_EGT[10] * cff) + (c_EGT[11] * mach) + (c_EGT[12] * alt))                  //
+           + mach * (c_EGT[4] + (c_EGT[13] * mach) + (c_EGT[14] * alt))                                     //
+           + alt * (c_EGT[5] + (c_EGT[15] * alt));
   }
 
   /**
@@ -358,27 +339,16 @@ class Polynomial_A380X {
         1.2728e-11    // coefficient for x^20
     };
 
-    double outCFF = c_Flow[0]                                   //
-                    + c_Flow[1]                                 //
-                    + (c_Flow[2] * cn1)                         //
-                    + (c_Flow[3] * mach)                        //
-                    + (c_Flow[4] * alt)                         //
-                    + (c_Flow[5] * (std::pow)(cn1, 2))          //
-                    + (c_Flow[6] * cn1 * mach)                  //
-                    + (c_Flow[7] * cn1 * alt)                   //
-                    + (c_Flow[8] * (std::pow)(mach, 2))         //
-                    + (c_Flow[9] * mach * alt)                  //
-                    + (c_Flow[10] * (std::pow)(alt, 2))         //
-                    + (c_Flow[11] * (std::pow)(cn1, 3))         //
-                    + (c_Flow[12] * (std::pow)(cn1, 2) * mach)  //
-                    + (c_Flow[13] * (std::pow)(cn1, 2) * alt)   //
-                    + (c_Flow[14] * cn1 * (std::pow)(mach, 2))  //
-                    + (c_Flow[15] * cn1 * mach * alt)           //
-                    + (c_Flow[16] * cn1 * (std::pow)(alt, 2))   //
-                    + (c_Flow[17] * (std::pow)(mach, 3))        //
-                    + (c_Flow[18] * (std::pow)(mach, 2) * alt)  //
-                    + (c_Flow[19] * mach * (std::pow)(alt, 2))  //
-                    + (c_Flow[20] * (std::pow)(alt, 3));        //
+    // Calculate the Corrected Fuel Flow value using a polynomial model, with the terms grouped by variable
+    double outCFF = c_Flow[0] + c_Flow[1]                                                                         //
+                    + cn1 * (c_Flow[2]                                                                            //
+                             + cn1 * (c_Flow[5] + (c_Flow[11] * cn1) + (c_Flow[12] * mach) + (c_Flow[13] * alt))  //
+                             + mach * (c_Flow[6] + (c_Flow[14] * mach) + (c_Flow[15] * alt))                      //
+                             + alt * (c_Flow[7] + (c_Flow[16] * alt)))                                            //
+                    + mach * (c_Flow[3]                                                                           //
+                              + mach * (c_Flow[8] + (c_Flow[17] * mach) + (c_Flow[18] * alt))                     //
+                              + alt * (c_Flow[9] + (c_Flow[19] * alt)))                                           //
+                    + alt * (c_Flow[4] + alt * (c_Flow[10] + (c_Flow[20] * alt)));
 
     // TODO: Adjust the corrected fuel flow to account for the A380 double fuel flow. Will have to be taken care of.
     return 2 * outCFF;
@@ -429,7 +399,7 @@ class Polynomial_A380X {
   static double oilGulpPct(double thrust) {
     const double oilGulpCoefficients[3] = {20.1968848, -1.2270302e-4, 1.78442e-8};
     const double oilGulpPercentage =
-        oilGulpCoefficients[0] + (oilGulpCoefficients[1] * thrust) + (oilGulpCoefficients[2] * (std::pow)(thrust, 2));
+        oilGulpCoefficients[0] + (oilGulpCoefficients[1] * thrust) + (oilGulpCoefficients[2] * thrust * thrust);
     return oilGulpPercentage / 100;
   }
 
@@ -442,7 +412,7 @@ class Polynomial_A380X {
    */
   static double oilPressure(double simN3) {
     double oilPressureCoefficients[3] = {-0.88921, 0.23711, 0.00682};
-    return oilPressureCoefficients[0] + (oilPressureCoefficients[1] * simN3) + (oilPressureCoefficients[2] * (std::pow)(simN3, 2));
+    return oilPressureCoefficients[0] + (oilPressureCoefficients[1] * simN3) + (oilPressureCoefficients[2] * simN3 * simN3);
   }
 };
 
@@ -5,13 +5,11 @@
 #define FLYBYWIRE_AIRCRAFT_THRUSTLIMITS_A380X_HPP
 
 #include <algorithm>
-#include <map>
-#include <sstream>
-
-#include "logging.h"
+#include <array>
 
 #include "EngineRatios.hpp"
-#include "Fadec.h"
+#include "FadecMath.hpp"
+#include "GridLookupTable.hpp"
 
 /**
  * @class ThrustLimits_A3800X
@@ -115,24 +113,63 @@ class ThrustLimits_A380X {
       {39000, -47.286, -18.508, 97.278, 85.545, 0.000}   // row 71
   };
 
- public:
   /**
-   * @brief Finds the top-row boundary in the limits array.
+   * @brief The sections of the limits array with precomputed slopes and a uniform index grid over the altitude.
+   */
+  static constexpr GridLookupTable<21, 6> takeoffLimits{limits, 0};
+  static constexpr GridLookupTable<21, 6> goAroundLimits{limits, 21};
+  static constexpr GridLookupTable<17, 6> climbLimits{limits, 42};
+  static constexpr GridLookupTable<13, 6> maximumContinuousLimits{limits, 59};
+
+  /**
+   * @brief Structure to store the bleed values for different types of limits.
    *
-   * @param altitude The altitude to find the top-row boundary for.
-   * @param index The index to start the search from.
-   * @return The index of the top-row boundary in the limits array.
+   * This structure contains three members, each representing a specific bleed value:
+   * - `n1Packs`: A double representing the bleed value for the packs.
+   * - `n1Nai`: A double representing the bleed value for the nacelle anti-ice.
+   * - `n1Wai`: A double representing the bleed value for the wing anti-ice.
    */
-  static int finder(double altitude, int index) {
-    while (altitude >= limits[index][0]) {
-      index++;
-    }
-    return index;
-  }
+  struct BleedValues {
+    double n1Packs;
+    double n1Nai;
+    double n1Wai;
+  };
+
+  /**
+   * @brief Lookup table for bleed values based on limit type.
+   *
+   * The table is indexed by the type of limit (0-TO, 1-GA, 2-CLB, 3-MCT), whether the altitude is less than 8000 ft
+   * and whether the outside air temperature is less than the corner point. CLB and MCT have no bleed correction below
+   * the corner point.
+   */
+  static constexpr BleedValues bleedValuesLookup[4][2][2] = {
+      // TO
+      {{{-0.7, -0.8, -0.8}, {-0.6, -0.8, -0.8}},   // altitude >= 8000
+       {{-0.5, -0.6, -0.7}, {-0.4, -0.6, -0.7}}},  // altitude < 8000
+      // GA
+      {{{-0.6, -0.7, -0.8}, {-0.6, -0.7, -0.8}},   // altitude >= 8000
+       {{-0.4, -0.6, -0.6}, {-0.4, -0.6, -0.6}}},  // altitude < 8000
+      // CLB
+      {{{-0.3, -0.8, -0.4}, {0.0, 0.0, 0.0}},      // altitude >= 8000
+       {{-0.2, -0.8, -0.4}, {0.0, 0.0, 0.0}}},     // altitude < 8000
+      // MCT
+      {{{-0.6, -0.9, -1.2}, {0.0, 0.0, 0.0}},      // altitude >= 8000
+       {{-0.6, -0.9, -1.2}, {0.0, 0.0, 0.0}}}      // altitude < 8000
+  };
+
+ public:
+  /**
+   * @brief The altitude in feet above which the CLB limit is based on 300 kt instead of 250 kt.
+   */
+  static constexpr double CLIMB_SPEED_CHANGE_ALTITUDE = 10000;
 
   /**
    * @brief Calculates the total bleed for the engine.
    *
+   * The flex bleed only applies to flex temperatures above the limit point. Where the limit point is constant between
+   * two rows of the thrust limit table it is exactly the tabulated value, so a flex temperature equal to it uses the
+   * normal bleed.
+   *
    * @param type The type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
    * @param altitude The current altitude of the aircraft in feet.
    * @param oat The outside air temperature in degrees Celsius.
@@ -159,121 +196,84 @@ class ThrustLimits_A380X {
       return packs * -0.6 + nacelle * -0.7 + wing * -0.7;
     }
 
-    // Define a map to store the bleed values for different conditions
-    // Keys:
-    // int - Represents the type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
-    // bool - Represents whether the altitude is less than 8000.
-    // bool - Represents whether the outside air temperature is less than the corner point.
-    // Values:
-    // double - Represents the bleed value for the packs.
-    // double - Represents the bleed value for the nacelle anti-ice.
-    // double - Represents the bleed value for the wing anti-ice.
-    std::map<std::tuple<int, bool, bool>, std::tuple<double, double, double>> bleedValues = {
-        {{0, true, true}, {-0.4, -0.6, -0.7}},    //
-        {{0, true, false}, {-0.5, -0.6, -0.7}},   //
-        {{0, false, true}, {-0.6, -0.8, -0.8}},   //
-        {{0, false, false}, {-0.7, -0.8, -0.8}},  //
-        {{1, true, true}, {-0.4, -0.6, -0.6}},    //
-        {{1, true, false}, {-0.4, -0.6, -0.6}},   //
-        {{1, false, true}, {-0.6, -0.7, -0.8}},   //
-        {{1, false, false}, {-0.6, -0.7, -0.8}},  //
-        {{2, true, false}, {-0.2, -0.8, -0.4}},   //
-        {{2, false, false}, {-0.3, -0.8, -0.4}},  //
-        {{3, true, false}, {-0.6, -0.9, -1.2}},   //
-        {{3, false, false}, {-0.6, -0.9, -1.2}}   //
-    };
-
-    double n1Packs = 0;
-    double n1Nai = 0;
-    double n1Wai = 0;
+    if (type < 0 || type > 3) {
+      return 0;
+    }
 
-    // Use the map to get the bleed values
-    std::tie(n1Packs, n1Nai, n1Wai) = bleedValues[{type, altitude < 8000, oat < cp}];
+    const BleedValues& bleed = bleedValuesLookup[type][altitude < 8000][oat < cp];
+    return packs * bleed.n1Packs + nacelle * bleed.n1Nai + wing * bleed.n1Wai;
+  }
 
-    return packs * n1Packs + nacelle * n1Nai + wing * n1Wai;
+  /**
+   * @brief Returns the row of the thrust limit table for the given type of limit, interpolated at the altitude.
+   *
+   * @param type The type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param altitude The current altitude of the aircraft in feet.
+   * @return The altitude, CP, LP, CN1 flat, CN1 last and CN1 flex, all zero for an unknown type.
+   */
+  static std::array<double, 6> limitRow(int type, double altitude) {
+    switch (type) {
+      case 0: // TO
+        return takeoffLimits.row(altitude);
+      case 1: // GA
+        return goAroundLimits.row(altitude);
+      case 2: // CLB
+        return climbLimits.row(altitude);
+      case 3: // MCT
+        return maximumContinuousLimits.row(altitude);
+      default:
+        return {};
+    }
   }
 
   /**
-   * @brief Calculates the N1 limit based on the given parameters.
+   * @brief Calculates the N1 limit for the engine without the bleed correction.
    *
-   * This function calculates the N1 limit based on the type of limit, altitude, ambient temperature,
-   * ambient pressure, flex temperature, and the status of the air conditioning, nacelle anti-ice,
-   * and wing anti-ice. It uses a series of calculations and interpolations
-   * to determine the N1 limit.
+   * Unlike the bleed correction this part of the limit has no steps in the ambient temperature, and the only step in
+   * the altitude is the CLB speed change at CLIMB_SPEED_CHANGE_ALTITUDE.
    *
-   * @param type An integer representing the type of limit (0-TO, 1-GA, 2-CLB, 3-MCT).
-   * @param altitude A double representing the altitude.
-   * @param ambientTemp A double representing the ambient temperature.
-   * @param ambientPressure A double representing the ambient pressure.
-   * @param flexTemp A double representing the flex temperature.
-   * @param packs A double representing the air conditioning status.
-   * @param nacelle A double representing the nacelle anti-ice status.
-   * @param wing A double representing the wing anti-ice status.
-   * @return The N1 limit as a double.
+   * @param type The type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param row The row of the thrust limit table at the altitude, see limitRow().
+   * @param altitude The current altitude of the aircraft in feet.
+   * @param ambientTemp The ambient temperature in degrees Celsius.
+   * @param ambientPressure The ambient pressure in hPa.
+   * @param flexTemp The flex temperature in degrees Celsius.
+   * @return The N1 limit for the engine without the bleed correction.
    */
-  static double limitN1(int type,                //
-                        double altitude,         //
-                        double ambientTemp,      //
-                        double ambientPressure,  //
-                        double flexTemp,         //
-                        double packs,            //
-                        double nacelle,          //
-                        double wing              //
+  static double limitN1WithoutBleed(int type,                          //
+                                    const std::array<double, 6>& row,  //
+                                    double altitude,                   //
+                                    double ambientTemp,                //
+                                    double ambientPressure,            //
+                                    double flexTemp                    //
   ) {
-    int rowMin = 0;
-    int rowMax = 0;
-    int loAltRow = 0;
-    int hiAltRow = 0;
     double mach = 0;
 
-    // Set main variables per Limit Type
+    // Set the Mach number per Limit Type
     switch (type) {
-      case 0: // TO
-        rowMin = 0;
-        rowMax = 20;
-        mach = 0;
-        break;
       case 1: // GA
-        rowMin = 21;
-        rowMax = 41;
         mach = 0.225;
         break;
       case 2: // CLB
-        rowMin = 42;
-        rowMax = 58;
-        if (altitude <= 10000) {
-          mach = Fadec::cas2mach(250, ambientPressure);
+        if (altitude <= CLIMB_SPEED_CHANGE_ALTITUDE) {
+          mach = FadecMath::cas2mach(250, ambientPressure);
         } else {
-          mach = Fadec::cas2mach(300, ambientPressure);
+          mach = FadecMath::cas2mach(300, ambientPressure);
           if (mach > 0.78)
             mach = 0.78;
         }
         break;
       case 3: // MCT
-        rowMin = 59;
-        rowMax = 71;
-        mach = Fadec::cas2mach(230, ambientPressure);
+        mach = FadecMath::cas2mach(230, ambientPressure);
         break;
     }
 
-    // Check for over/under flows. Else, find top row value
-    if (altitude <= limits[rowMin][0]) {
-      hiAltRow = rowMin;
-      loAltRow = rowMin;
-    } else if (altitude >= limits[rowMax][0]) {
-      hiAltRow = rowMax;
-      loAltRow = rowMax;
-    } else {
-      hiAltRow = finder(altitude, rowMin);
-      loAltRow = hiAltRow - 1;
-    }
-
     // Define key table variables and interpolation
-    const double cp = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][1], limits[hiAltRow][1]);
-    const double lp = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][2], limits[hiAltRow][2]);
-    const double cn1Flat = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][3], limits[hiAltRow][3]);
-    const double cn1Last = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][4], limits[hiAltRow][4]);
-    const double cn1Flex = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][5], limits[hiAltRow][5]);
+    const double cp = row[1];
+    const double lp = row[2];
+    const double cn1Flat = row[3];
+    const double cn1Last = row[4];
+    const double cn1Flex = row[5];
 
     double cn1 = 0;
     double m = 0;
@@ -301,10 +301,39 @@ class ThrustLimits_A380X {
       }
     }
 
-    // Define bleed rating/ de-rating
-    const double bleed = bleedTotal(type, altitude, ambientTemp, cp, lp, flexTemp, packs, nacelle, wing);
+    return cn1 * (std::sqrt)(EngineRatios::theta2(mach, ambientTemp));
+  }
 
-    return (cn1 * (std::sqrt)(EngineRatios::theta2(mach, ambientTemp))) + bleed;
+  /**
+   * @brief Calculates the N1 limit based on the given parameters.
+   *
+   * This function calculates the N1 limit based on the type of limit, altitude, ambient temperature,
+   * ambient pressure, flex temperature, and the status of the air conditioning, nacelle anti-ice,
+   * and wing anti-ice. It uses a series of calculations and interpolations
+   * to determine the N1 limit.
+   *
+   * @param type An integer representing the type of limit (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param altitude A double representing the altitude.
+   * @param ambientTemp A double representing the ambient temperature.
+   * @param ambientPressure A double representing the ambient pressure.
+   * @param flexTemp A double representing the flex temperature.
+   * @param packs A double representing the air conditioning status.
+   * @param nacelle A double representing the nacelle anti-ice status.
+   * @param wing A double representing the wing anti-ice status.
+   * @return The N1 limit as a double.
+   */
+  static double limitN1(int type,                //
+                        double altitude,         //
+                        double ambientTemp,      //
+                        double ambientPressure,  //
+                        double flexTemp,         //
+                        double packs,            //
+                        double nacelle,          //
+                        double wing              //
+  ) {
+    const std::array<double, 6> row = limitRow(type, altitude);
+    return limitN1WithoutBleed(type, row, altitude, ambientTemp, ambientPressure, flexTemp) +
+           bleedTotal(type, altitude, ambientTemp, row[1], row[2], flexTemp, packs, nacelle, wing);
   }
 };
 
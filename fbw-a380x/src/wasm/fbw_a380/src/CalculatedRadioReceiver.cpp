@@ -15,34 +15,14 @@ RadioReceiverResult RadioReceiver::calculateLocalizerDeviation(bool loc_valid,
                                                                double aircraft_position_lat,
                                                                double aircraft_position_lon,
                                                                double aircraft_position_alt) {
-  // conversion
-  double Phi1 = deg2rad(aircraft_position_lat);
-  double Phi2 = deg2rad(loc_position_lat);
-  double Gamma1 = deg2rad(aircraft_position_lon);
-  double Gamma2 = deg2rad(loc_position_lon);
+  // the station trigonometry is cached, the aircraft's is shared with the glide slope
+  aircraftPosition.set(aircraft_position_lat, aircraft_position_lon, aircraft_position_alt);
+  localizerPosition.set(loc_position_lat, loc_position_lon, loc_position_alt);
+  Geodesy::Geometry geometry = Geodesy::relative(aircraftPosition, localizerPosition);
 
-  // deltas
-  double deltaPhi = deg2rad(loc_position_lat - aircraft_position_lat);
-  double deltaGamma = deg2rad(loc_position_lon - aircraft_position_lon);
-
-  // calculate distance
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  double a = sin(deltaPhi / 2.0) * sin(deltaPhi / 2.0) + cos(Phi1) * cos(Phi2) * sin(deltaGamma / 2.0) * sin(deltaGamma / 2.0);
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  double c = 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
-
-  double distance_m = EARTH_RADIUS_METER * c;  // meters
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  distance_m = sqrt(pow(distance_m, 2.0) + pow(aircraft_position_alt - loc_position_alt, 2.0));
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  double distance = distance_m / 1852.0;  // in nm
-
-  // calculate bearing
-  double y = sin(Gamma2 - Gamma1) * cos(Phi2);
-  double x = cos(Phi1) * sin(Phi2) - sin(Phi1) * cos(Phi2) * cos(Gamma2 - Gamma1);
-  double Theta = atan2(y, x);
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  double bearing = fmod((rad2deg(Theta) + 360.0), 360.0);  // in degrees
+  double distance = geometry.slantDistance_m / 1852.0;  // in nm
+  double bearing = geometry.bearing_deg;
 
   // calculate deviation
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
@@ -81,34 +61,14 @@ RadioReceiverResult RadioReceiver::calculateGlideSlopeDeviation(bool gs_valid,
     gs_deg = cached_gs_deg;
   }
 
-  // conversion
-  double Phi1 = deg2rad(aircraft_position_lat);
-  double Phi2 = deg2rad(gs_position_lat);
-  double Gamma1 = deg2rad(aircraft_position_lon);
-  double Gamma2 = deg2rad(gs_position_lon);
-
-  // deltas
-  double deltaPhi = deg2rad(gs_position_lat - aircraft_position_lat);
-  double deltaGamma = deg2rad(gs_position_lon - aircraft_position_lon);
+  aircraftPosition.set(aircraft_position_lat, aircraft_position_lon, aircraft_position_alt);
+  glideSlopePosition.set(gs_position_lat, gs_position_lon, gs_position_alt);
+  Geodesy::Geometry geometry = Geodesy::relative(aircraftPosition, glideSlopePosition);
 
-  // calculate distance
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  double a = sin(deltaPhi / 2.0) * sin(deltaPhi / 2.0) + cos(Phi1) * cos(Phi2) * sin(deltaGamma / 2.0) * sin(deltaGamma / 2.0);
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  double c = 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
-
-  double distance_m = EARTH_RADIUS_METER * c;  // meters
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  distance_m = sqrt(pow(distance_m, 2.0) + pow(aircraft_position_alt - gs_position_alt, 2.0));
+  double distance_m = geometry.slantDistance_m;
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
   double distance = distance_m / 1852.0;  // in nm
-
-  // calculate bearing
-  double y = sin(Gamma2 - Gamma1) * cos(Phi2);
-  double x = cos(Phi1) * sin(Phi2) - sin(Phi1) * cos(Phi2) * cos(Gamma2 - Gamma1);
-  double Theta = atan2(y, x);
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  double bearing = fmod((rad2deg(Theta) + 360.0), 360.0);  // in degrees
+  double bearing = geometry.bearing_deg;
 
   // calculate deviation
   double deviation = rad2deg(asin((aircraft_position_alt - gs_position_alt) / distance_m)) - gs_deg;
@@ -151,11 +111,6 @@ double RadioReceiver::headingDifference(double u1, double u2) {
   }
 }
 
-double RadioReceiver::deg2rad(double degrees) {
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-  return (degrees * M_PI) / 180.0;
-}
-
 double RadioReceiver::rad2deg(double radians) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
   return (radians * 180.0) / M_PI;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -91,25 +92,38 @@ bool FlyByWireInterface::update(double sampleTime) {
   // do not process laws in pause or slew
   if (simData.slew_on) {
     wasInSlew = true;
+    resetModelRateGroups();
     return result;
   } else if (pauseDetected || simData.cameraState >= 10.0 || !idIsReady->get() || simData.simulationTime < 2) {
+    resetModelRateGroups();
     return result;
   }
 
   // update altimeter setting
   result &= updateAltimeterSetting(calculatedSampleTime);
 
-  // update autopilot state machine
-  result &= updateAutopilotStateMachine(calculatedSampleTime);
+  // autopilot and autothrust run at their configured rate and hold their outputs in between, the FCU inputs are
+  // kept until the autopilot has been stepped and only seen by its first step
+  int autopilotSteps = autopilotRateGroup.update(calculatedSampleTime);
+  double autopilotSampleTime = autopilotRateGroup.getStepTime();
 
-  // update autopilot laws
-  result &= updateAutopilotLaws(calculatedSampleTime);
+  for (int step = 0; step < autopilotSteps; step++) {
+    // update autopilot state machine
+    result &= updateAutopilotStateMachine(autopilotSampleTime);
+
+    // update autopilot laws
+    result &= updateAutopilotLaws(autopilotSampleTime);
+
+    simConnectInterface.resetSimInputAutopilot();
+  }
 
   // update fly-by-wire
   result &= updateFlyByWire(calculatedSampleTime);
 
-  // get throttle data and process it
-  result &= updateAutothrust(calculatedSampleTime);
+  for (int step = 0; step < autopilotSteps; step++) {
+    // get throttle data and process it
+    result &= updateAutothrust(autopilotSampleTime);
+  }
 
   for (int i = 0; i < 3; i++) {
     result &= updateRa(i);
@@ -127,21 +141,36 @@ bool FlyByWireInterface::update(double sampleTime) {
     result &= updateAdirs(i);
   }
 
-  for (int i = 0; i < 3; i++) {
-    result &= updatePrim(calculatedSampleTime, i);
-  }
+  // flight control computers run at their configured rate, the surface commands are interpolated between the outputs
+  // of the last two steps, the trim inputs are held until a frame in which the computers are stepped
+  int flightControlsSteps = flightControlsRateGroup.update(calculatedSampleTime);
+  double flightControlsSampleTime = flightControlsRateGroup.getStepTime();
 
-  for (int i = 0; i < 3; i++) {
-    result &= updateSec(calculatedSampleTime, i);
-  }
+  for (int step = 0; step < flightControlsSteps; step++) {
+    std::copy(std::begin(primsAnalogOutputs), std::end(primsAnalogOutputs), std::begin(primsAnalogOutputsPrevious));
+    std::copy(std::begin(secsAnalogOutputs), std::end(secsAnalogOutputs), std::begin(secsAnalogOutputsPrevious));
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateFac(calculatedSampleTime, i);
+    for (int i = 0; i < 3; i++) {
+      result &= updatePrim(flightControlsSampleTime, i);
+    }
+
+    for (int i = 0; i < 3; i++) {
+      result &= updateSec(flightControlsSampleTime, i);
+    }
+
+    for (int i = 0; i < 2; i++) {
+      result &= updateFac(flightControlsSampleTime, i);
+    }
+
+    // for (int i = 0; i < 2; i++) {
+    //   result &= updateFcdc(flightControlsSampleTime, i);
+    // }
   }
 
-  // for (int i = 0; i < 2; i++) {
-  //   result &= updateFcdc(calculatedSampleTime, i);
-  // }
+  if (flightControlsSteps > 0) {
+    simConnectInterface.resetSimInputPitchTrim();
+    simConnectInterface.resetSimInputRudderTrim();
+  }
 
   result &= updateServoSolenoidStatus();
 
@@ -191,6 +220,10 @@ void FlyByWireInterface::loadConfiguration() {
   secDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "SEC_DISABLED", -1);
   facDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "FAC_DISABLED", -1);
   tailstrikeProtectionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "TAILSTRIKE_PROTECTION_ENABLED", false);
+  autopilotRate = INITypeConversion::getDouble(iniStructure, "MODEL", "AUTOPILOT_RATE", 0);
+  flightControlsRate = INITypeConversion::getDouble(iniStructure, "MODEL", "FLIGHT_CONTROLS_RATE", 0);
+  autopilotRateGroup.setRate(autopilotRate);
+  flightControlsRateGroup.setRate(flightControlsRate);
 
   // if any model is deactivated we need to enable client data
   clientDataEnabled = (primDisabled != -1 || secDisabled != -1 || facDisabled != -1 || !autopilotStateMachineEnabled ||
@@ -206,6 +239,8 @@ void FlyByWireInterface::loadConfiguration() {
   std::cout << "WASM: MODEL     : SEC_DISABLED                         = " << secDisabled << std::endl;
   std::cout << "WASM: MODEL     : FAC_DISABLED                         = " << facDisabled << std::endl;
   std::cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED        = " << tailstrikeProtectionEnabled << std::endl;
+  std::cout << "WASM: MODEL     : AUTOPILOT_RATE                       = " << autopilotRate << std::endl;
+  std::cout << "WASM: MODEL     : FLIGHT_CONTROLS_RATE                 = " << flightControlsRate << std::endl;
 
   // --------------------------------------------------------------------------
   // load values - autopilot
@@ -269,15 +304,6 @@ void FlyByWireInterface::loadConfiguration() {
     // store axis
     throttleAxis.emplace_back(axis);
   }
-
-  // create mapping for 3D animation position
-  std::vector<std::pair<double, double>> mappingTable3d;
-  mappingTable3d.emplace_back(-20.0, 0.0);
-  mappingTable3d.emplace_back(0.0, 0.0);
-  mappingTable3d.emplace_back(25.0, 50.0);
-  mappingTable3d.emplace_back(35.0, 75.0);
-  mappingTable3d.emplace_back(45.0, 100.0);
-  idThrottlePositionLookupTable3d.initialize(mappingTable3d, 0, 100);
 }
 
 void FlyByWireInterface::setupLocalVariables() {
@@ -838,13 +864,6 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   // set sample time
   simConnectInterface.setSampleTime(sampleTime);
 
-  // reset input
-  simConnectInterface.resetSimInputAutopilot();
-
-  simConnectInterface.resetSimInputPitchTrim();
-
-  simConnectInterface.resetSimInputRudderTrim();
-
   // set logging options
   simConnectInterface.setLoggingFlightControlsEnabled(idLoggingFlightControlsEnabled->get() == 1);
   simConnectInterface.setLoggingThrottlesEnabled(idLoggingThrottlesEnabled->get() == 1);
@@ -1883,134 +1902,208 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
   return true;
 }
 
+// The time of the rate groups is dropped so that it is not caught up afterwards, as are the inputs that arrived in the
+// meantime.
+void FlyByWireInterface::resetModelRateGroups() {
+  autopilotRateGroup.reset();
+  flightControlsRateGroup.reset();
+  simConnectInterface.resetSimInputAutopilot();
+  simConnectInterface.resetSimInputPitchTrim();
+  simConnectInterface.resetSimInputRudderTrim();
+}
+
+// The commands are interpolated from the previous towards the current computer output, so the surfaces follow the
+// computers with a lag of one flight controls period.
+double FlyByWireInterface::interpolateCommand(double previous, double current) {
+  return previous + (current - previous) * flightControlsRateGroup.getInterpolationFactor();
+}
+
 bool FlyByWireInterface::updateServoSolenoidStatus() {
   idLeftInboardAileronSolenoidEnergized[0]->set(primsDiscreteOutputs[0].left_aileron_1_active_mode ||
                                                 secsDiscreteOutputs[0].left_aileron_1_active_mode);
-  idLeftInboardAileronCommandedPosition[0]->set(primsAnalogOutputs[0].left_aileron_1_pos_order_deg +
-                                                secsAnalogOutputs[0].left_aileron_1_pos_order_deg);
+  idLeftInboardAileronCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].left_aileron_1_pos_order_deg +
+                         secsAnalogOutputsPrevious[0].left_aileron_1_pos_order_deg,
+                         primsAnalogOutputs[0].left_aileron_1_pos_order_deg + secsAnalogOutputs[0].left_aileron_1_pos_order_deg));
   idLeftInboardAileronSolenoidEnergized[1]->set(primsDiscreteOutputs[1].left_aileron_2_active_mode ||
                                                 secsDiscreteOutputs[1].left_aileron_2_active_mode);
-  idLeftInboardAileronCommandedPosition[1]->set(primsAnalogOutputs[1].left_aileron_2_pos_order_deg +
-                                                secsAnalogOutputs[1].left_aileron_2_pos_order_deg);
+  idLeftInboardAileronCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[1].left_aileron_2_pos_order_deg +
+                         secsAnalogOutputsPrevious[1].left_aileron_2_pos_order_deg,
+                         primsAnalogOutputs[1].left_aileron_2_pos_order_deg + secsAnalogOutputs[1].left_aileron_2_pos_order_deg));
   idRightInboardAileronSolenoidEnergized[0]->set(primsDiscreteOutputs[0].right_aileron_1_active_mode ||
                                                  secsDiscreteOutputs[0].right_aileron_1_active_mode);
-  idRightInboardAileronCommandedPosition[0]->set(primsAnalogOutputs[0].right_aileron_1_pos_order_deg +
-                                                 secsAnalogOutputs[0].right_aileron_1_pos_order_deg);
+  idRightInboardAileronCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].right_aileron_1_pos_order_deg +
+                         secsAnalogOutputsPrevious[0].right_aileron_1_pos_order_deg,
+                         primsAnalogOutputs[0].right_aileron_1_pos_order_deg + secsAnalogOutputs[0].right_aileron_1_pos_order_deg));
   idRightInboardAileronSolenoidEnergized[1]->set(primsDiscreteOutputs[1].right_aileron_2_active_mode ||
                                                  secsDiscreteOutputs[1].right_aileron_2_active_mode);
-  idRightInboardAileronCommandedPosition[1]->set(primsAnalogOutputs[1].right_aileron_2_pos_order_deg +
-                                                 secsAnalogOutputs[1].right_aileron_2_pos_order_deg);
+  idRightInboardAileronCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[1].right_aileron_2_pos_order_deg +
+                         secsAnalogOutputsPrevious[1].right_aileron_2_pos_order_deg,
+                         primsAnalogOutputs[1].right_aileron_2_pos_order_deg + secsAnalogOutputs[1].right_aileron_2_pos_order_deg));
 
   idLeftMidboardAileronSolenoidEnergized[0]->set(primsDiscreteOutputs[2].left_aileron_1_active_mode ||
                                                  secsDiscreteOutputs[2].left_aileron_1_active_mode);
-  idLeftMidboardAileronCommandedPosition[0]->set(primsAnalogOutputs[2].left_aileron_1_pos_order_deg +
-                                                 secsAnalogOutputs[2].left_aileron_1_pos_order_deg);
+  idLeftMidboardAileronCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[2].left_aileron_1_pos_order_deg +
+                         secsAnalogOutputsPrevious[2].left_aileron_1_pos_order_deg,
+                         primsAnalogOutputs[2].left_aileron_1_pos_order_deg + secsAnalogOutputs[2].left_aileron_1_pos_order_deg));
   idLeftMidboardAileronSolenoidEnergized[1]->set(primsDiscreteOutputs[0].left_aileron_2_active_mode ||
                                                  secsDiscreteOutputs[0].left_aileron_2_active_mode);
-  idLeftMidboardAileronCommandedPosition[1]->set(primsAnalogOutputs[0].left_aileron_2_pos_order_deg +
-                                                 secsAnalogOutputs[0].left_aileron_2_pos_order_deg);
+  idLeftMidboardAileronCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].left_aileron_2_pos_order_deg +
+                         secsAnalogOutputsPrevious[0].left_aileron_2_pos_order_deg,
+                         primsAnalogOutputs[0].left_aileron_2_pos_order_deg + secsAnalogOutputs[0].left_aileron_2_pos_order_deg));
   idRightMidboardAileronSolenoidEnergized[0]->set(primsDiscreteOutputs[2].right_aileron_1_active_mode ||
                                                   secsDiscreteOutputs[2].right_aileron_1_active_mode);
-  idRightMidboardAileronCommandedPosition[0]->set(primsAnalogOutputs[2].right_aileron_1_pos_order_deg +
-                                                  secsAnalogOutputs[2].right_aileron_1_pos_order_deg);
+  idRightMidboardAileronCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[2].right_aileron_1_pos_order_deg +
+                         secsAnalogOutputsPrevious[2].right_aileron_1_pos_order_deg,
+                         primsAnalogOutputs[2].right_aileron_1_pos_order_deg + secsAnalogOutputs[2].right_aileron_1_pos_order_deg));
   idRightMidboardAileronSolenoidEnergized[1]->set(primsDiscreteOutputs[0].right_aileron_2_active_mode ||
                                                   secsDiscreteOutputs[0].right_aileron_2_active_mode);
-  idRightMidboardAileronCommandedPosition[1]->set(primsAnalogOutputs[0].right_aileron_2_pos_order_deg +
-                                                  secsAnalogOutputs[0].right_aileron_2_pos_order_deg);
+  idRightMidboardAileronCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].right_aileron_2_pos_order_deg +
+                         secsAnalogOutputsPrevious[0].right_aileron_2_pos_order_deg,
+                         primsAnalogOutputs[0].right_aileron_2_pos_order_deg + secsAnalogOutputs[0].right_aileron_2_pos_order_deg));
 
   idLeftOutboardAileronSolenoidEnergized[0]->set(primsDiscreteOutputs[1].left_aileron_1_active_mode);
-  idLeftOutboardAileronCommandedPosition[0]->set(primsAnalogOutputs[1].left_aileron_1_pos_order_deg);
+  idLeftOutboardAileronCommandedPosition[0]->set(interpolateCommand(primsAnalogOutputsPrevious[1].left_aileron_1_pos_order_deg,
+                                                                    primsAnalogOutputs[1].left_aileron_1_pos_order_deg));
   idLeftOutboardAileronSolenoidEnergized[1]->set(primsDiscreteOutputs[2].left_aileron_2_active_mode);
-  idLeftOutboardAileronCommandedPosition[1]->set(primsAnalogOutputs[2].left_aileron_2_pos_order_deg);
+  idLeftOutboardAileronCommandedPosition[1]->set(interpolateCommand(primsAnalogOutputsPrevious[2].left_aileron_2_pos_order_deg,
+                                                                    primsAnalogOutputs[2].left_aileron_2_pos_order_deg));
   idRightOutboardAileronSolenoidEnergized[0]->set(primsDiscreteOutputs[1].right_aileron_1_active_mode);
-  idRightOutboardAileronCommandedPosition[0]->set(primsAnalogOutputs[1].right_aileron_1_pos_order_deg);
+  idRightOutboardAileronCommandedPosition[0]->set(interpolateCommand(primsAnalogOutputsPrevious[1].right_aileron_1_pos_order_deg,
+                                                                     primsAnalogOutputs[1].right_aileron_1_pos_order_deg));
   idRightOutboardAileronSolenoidEnergized[1]->set(primsDiscreteOutputs[2].right_aileron_2_active_mode);
-  idRightOutboardAileronCommandedPosition[1]->set(primsAnalogOutputs[2].right_aileron_2_pos_order_deg);
-
-  idLeftSpoilerCommandedPosition[0]->set(-secsAnalogOutputs[2].left_spoiler_1_pos_order_deg);
-  idRightSpoilerCommandedPosition[0]->set(-secsAnalogOutputs[2].right_spoiler_1_pos_order_deg);
-  idLeftSpoilerCommandedPosition[1]->set(-secsAnalogOutputs[1].left_spoiler_1_pos_order_deg);
-  idRightSpoilerCommandedPosition[1]->set(-secsAnalogOutputs[1].right_spoiler_1_pos_order_deg);
-  idLeftSpoilerCommandedPosition[2]->set(-secsAnalogOutputs[0].left_spoiler_1_pos_order_deg);
-  idRightSpoilerCommandedPosition[2]->set(-secsAnalogOutputs[0].right_spoiler_1_pos_order_deg);
-  idLeftSpoilerCommandedPosition[3]->set(-primsAnalogOutputs[2].left_spoiler_pos_order_deg);
-  idRightSpoilerCommandedPosition[3]->set(-primsAnalogOutputs[2].right_spoiler_pos_order_deg);
-  idLeftSpoilerCommandedPosition[4]->set(-primsAnalogOutputs[1].left_spoiler_pos_order_deg);
-  idRightSpoilerCommandedPosition[4]->set(-primsAnalogOutputs[1].right_spoiler_pos_order_deg);
+  idRightOutboardAileronCommandedPosition[1]->set(interpolateCommand(primsAnalogOutputsPrevious[2].right_aileron_2_pos_order_deg,
+                                                                     primsAnalogOutputs[2].right_aileron_2_pos_order_deg));
+
+  idLeftSpoilerCommandedPosition[0]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].left_spoiler_1_pos_order_deg,
+                                                             -secsAnalogOutputs[2].left_spoiler_1_pos_order_deg));
+  idRightSpoilerCommandedPosition[0]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].right_spoiler_1_pos_order_deg,
+                                                             -secsAnalogOutputs[2].right_spoiler_1_pos_order_deg));
+  idLeftSpoilerCommandedPosition[1]->set(interpolateCommand(-secsAnalogOutputsPrevious[1].left_spoiler_1_pos_order_deg,
+                                                            -secsAnalogOutputs[1].left_spoiler_1_pos_order_deg));
+  idRightSpoilerCommandedPosition[1]->set(interpolateCommand(-secsAnalogOutputsPrevious[1].right_spoiler_1_pos_order_deg,
+                                                             -secsAnalogOutputs[1].right_spoiler_1_pos_order_deg));
+  idLeftSpoilerCommandedPosition[2]->set(interpolateCommand(-secsAnalogOutputsPrevious[0].left_spoiler_1_pos_order_deg,
+                                                            -secsAnalogOutputs[0].left_spoiler_1_pos_order_deg));
+  idRightSpoilerCommandedPosition[2]->set(interpolateCommand(-secsAnalogOutputsPrevious[0].right_spoiler_1_pos_order_deg,
+                                                             -secsAnalogOutputs[0].right_spoiler_1_pos_order_deg));
+  idLeftSpoilerCommandedPosition[3]->set(interpolateCommand(-primsAnalogOutputsPrevious[2].left_spoiler_pos_order_deg,
+                                                            -primsAnalogOutputs[2].left_spoiler_pos_order_deg));
+  idRightSpoilerCommandedPosition[3]->set(interpolateCommand(-primsAnalogOutputsPrevious[2].right_spoiler_pos_order_deg,
+                                                             -primsAnalogOutputs[2].right_spoiler_pos_order_deg));
+  idLeftSpoilerCommandedPosition[4]->set(interpolateCommand(-primsAnalogOutputsPrevious[1].left_spoiler_pos_order_deg,
+                                                            -primsAnalogOutputs[1].left_spoiler_pos_order_deg));
+  idRightSpoilerCommandedPosition[4]->set(interpolateCommand(-primsAnalogOutputsPrevious[1].right_spoiler_pos_order_deg,
+                                                             -primsAnalogOutputs[1].right_spoiler_pos_order_deg));
   idLeftSpoiler6EbhaElectronicEnable->set(primsDiscreteOutputs[0].left_spoiler_electronic_module_enable);
-  idLeftSpoilerCommandedPosition[5]->set(-primsAnalogOutputs[0].left_spoiler_pos_order_deg);
+  idLeftSpoilerCommandedPosition[5]->set(interpolateCommand(-primsAnalogOutputsPrevious[0].left_spoiler_pos_order_deg,
+                                                            -primsAnalogOutputs[0].left_spoiler_pos_order_deg));
   idRightSpoiler6EbhaElectronicEnable->set(primsDiscreteOutputs[0].right_spoiler_electronic_module_enable);
-  idRightSpoilerCommandedPosition[5]->set(-primsAnalogOutputs[0].right_spoiler_pos_order_deg);
-  idLeftSpoilerCommandedPosition[6]->set(-secsAnalogOutputs[1].left_spoiler_2_pos_order_deg);
-  idRightSpoilerCommandedPosition[6]->set(-secsAnalogOutputs[1].right_spoiler_2_pos_order_deg);
-  idLeftSpoilerCommandedPosition[7]->set(-secsAnalogOutputs[2].left_spoiler_2_pos_order_deg);
-  idRightSpoilerCommandedPosition[7]->set(-secsAnalogOutputs[2].right_spoiler_2_pos_order_deg);
+  idRightSpoilerCommandedPosition[5]->set(interpolateCommand(-primsAnalogOutputsPrevious[0].right_spoiler_pos_order_deg,
+                                                             -primsAnalogOutputs[0].right_spoiler_pos_order_deg));
+  idLeftSpoilerCommandedPosition[6]->set(interpolateCommand(-secsAnalogOutputsPrevious[1].left_spoiler_2_pos_order_deg,
+                                                            -secsAnalogOutputs[1].left_spoiler_2_pos_order_deg));
+  idRightSpoilerCommandedPosition[6]->set(interpolateCommand(-secsAnalogOutputsPrevious[1].right_spoiler_2_pos_order_deg,
+                                                             -secsAnalogOutputs[1].right_spoiler_2_pos_order_deg));
+  idLeftSpoilerCommandedPosition[7]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].left_spoiler_2_pos_order_deg,
+                                                            -secsAnalogOutputs[2].left_spoiler_2_pos_order_deg));
+  idRightSpoilerCommandedPosition[7]->set(interpolateCommand(-secsAnalogOutputsPrevious[2].right_spoiler_2_pos_order_deg,
+                                                             -secsAnalogOutputs[2].right_spoiler_2_pos_order_deg));
 
   idLeftInboardElevatorSolenoidEnergized[0]->set(primsDiscreteOutputs[2].elevator_1_active_mode ||
                                                  secsDiscreteOutputs[2].elevator_1_active_mode);
-  idLeftInboardElevatorCommandedPosition[0]->set(primsAnalogOutputs[2].elevator_1_pos_order_deg +
-                                                 secsAnalogOutputs[2].elevator_1_pos_order_deg);
+  idLeftInboardElevatorCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[2].elevator_1_pos_order_deg + secsAnalogOutputsPrevious[2].elevator_1_pos_order_deg,
+                         primsAnalogOutputs[2].elevator_1_pos_order_deg + secsAnalogOutputs[2].elevator_1_pos_order_deg));
   idLeftInboardElevatorSolenoidEnergized[1]->set(primsDiscreteOutputs[0].elevator_2_active_mode ||
                                                  secsDiscreteOutputs[0].elevator_2_active_mode);
-  idLeftInboardElevatorCommandedPosition[1]->set(primsAnalogOutputs[0].elevator_2_pos_order_deg +
-                                                 secsAnalogOutputs[0].elevator_2_pos_order_deg);
+  idLeftInboardElevatorCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].elevator_2_pos_order_deg + secsAnalogOutputsPrevious[0].elevator_2_pos_order_deg,
+                         primsAnalogOutputs[0].elevator_2_pos_order_deg + secsAnalogOutputs[0].elevator_2_pos_order_deg));
   idRightInboardElevatorSolenoidEnergized[0]->set(primsDiscreteOutputs[2].elevator_2_active_mode ||
                                                   secsDiscreteOutputs[2].elevator_2_active_mode);
-  idRightInboardElevatorCommandedPosition[0]->set(primsAnalogOutputs[2].elevator_2_pos_order_deg +
-                                                  secsAnalogOutputs[2].elevator_2_pos_order_deg);
+  idRightInboardElevatorCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[2].elevator_2_pos_order_deg + secsAnalogOutputsPrevious[2].elevator_2_pos_order_deg,
+                         primsAnalogOutputs[2].elevator_2_pos_order_deg + secsAnalogOutputs[2].elevator_2_pos_order_deg));
   idRightInboardElevatorSolenoidEnergized[1]->set(primsDiscreteOutputs[1].elevator_3_active_mode ||
                                                   secsDiscreteOutputs[1].elevator_3_active_mode);
-  idRightInboardElevatorCommandedPosition[1]->set(primsAnalogOutputs[1].elevator_3_pos_order_deg +
-                                                  secsAnalogOutputs[1].elevator_3_pos_order_deg);
+  idRightInboardElevatorCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[1].elevator_3_pos_order_deg + secsAnalogOutputsPrevious[1].elevator_3_pos_order_deg,
+                         primsAnalogOutputs[1].elevator_3_pos_order_deg + secsAnalogOutputs[1].elevator_3_pos_order_deg));
 
   idLeftOutboardElevatorSolenoidEnergized[0]->set(primsDiscreteOutputs[0].elevator_1_active_mode ||
                                                   secsDiscreteOutputs[0].elevator_1_active_mode);
-  idLeftOutboardElevatorCommandedPosition[0]->set(primsAnalogOutputs[0].elevator_1_pos_order_deg +
-                                                  secsAnalogOutputs[0].elevator_1_pos_order_deg);
+  idLeftOutboardElevatorCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].elevator_1_pos_order_deg + secsAnalogOutputsPrevious[0].elevator_1_pos_order_deg,
+                         primsAnalogOutputs[0].elevator_1_pos_order_deg + secsAnalogOutputs[0].elevator_1_pos_order_deg));
   idLeftOutboardElevatorSolenoidEnergized[1]->set(primsDiscreteOutputs[1].elevator_2_active_mode ||
                                                   secsDiscreteOutputs[1].elevator_2_active_mode);
-  idLeftOutboardElevatorCommandedPosition[1]->set(primsAnalogOutputs[1].elevator_2_pos_order_deg +
-                                                  secsAnalogOutputs[1].elevator_2_pos_order_deg);
+  idLeftOutboardElevatorCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[1].elevator_2_pos_order_deg + secsAnalogOutputsPrevious[1].elevator_2_pos_order_deg,
+                         primsAnalogOutputs[1].elevator_2_pos_order_deg + secsAnalogOutputs[1].elevator_2_pos_order_deg));
   idRightOutboardElevatorSolenoidEnergized[0]->set(primsDiscreteOutputs[1].elevator_1_active_mode ||
                                                    secsDiscreteOutputs[1].elevator_1_active_mode);
-  idRightOutboardElevatorCommandedPosition[0]->set(primsAnalogOutputs[1].elevator_1_pos_order_deg +
-                                                   secsAnalogOutputs[1].elevator_1_pos_order_deg);
+  idRightOutboardElevatorCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[1].elevator_1_pos_order_deg + secsAnalogOutputsPrevious[1].elevator_1_pos_order_deg,
+                         primsAnalogOutputs[1].elevator_1_pos_order_deg + secsAnalogOutputs[1].elevator_1_pos_order_deg));
   idRightOutboardElevatorSolenoidEnergized[1]->set(primsDiscreteOutputs[0].elevator_3_active_mode ||
                                                    secsDiscreteOutputs[0].elevator_3_active_mode);
-  idRightOutboardElevatorCommandedPosition[1]->set(primsAnalogOutputs[0].elevator_3_pos_order_deg +
-                                                   secsAnalogOutputs[0].elevator_3_pos_order_deg);
+  idRightOutboardElevatorCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].elevator_3_pos_order_deg + secsAnalogOutputsPrevious[0].elevator_3_pos_order_deg,
+                         primsAnalogOutputs[0].elevator_3_pos_order_deg + secsAnalogOutputs[0].elevator_3_pos_order_deg));
 
   idTHSSolenoidEnergized[0]->set(primsDiscreteOutputs[2].ths_active_mode || secsDiscreteOutputs[2].ths_active_mode);
-  idTHSCommandedPosition[0]->set(primsAnalogOutputs[2].ths_pos_order_deg + secsAnalogOutputs[2].ths_pos_order_deg);
+  idTHSCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[2].ths_pos_order_deg + secsAnalogOutputsPrevious[2].ths_pos_order_deg,
+                         primsAnalogOutputs[2].ths_pos_order_deg + secsAnalogOutputs[2].ths_pos_order_deg));
   idTHSSolenoidEnergized[1]->set(primsDiscreteOutputs[0].ths_active_mode || secsDiscreteOutputs[0].ths_active_mode);
-  idTHSCommandedPosition[1]->set(primsAnalogOutputs[0].ths_pos_order_deg + secsAnalogOutputs[0].ths_pos_order_deg);
+  idTHSCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].ths_pos_order_deg + secsAnalogOutputsPrevious[0].ths_pos_order_deg,
+                         primsAnalogOutputs[0].ths_pos_order_deg + secsAnalogOutputs[0].ths_pos_order_deg));
 
   idUpperRudderHydraulicModeSolenoidEnergized[0]->set(primsDiscreteOutputs[0].rudder_1_hydraulic_active_mode ||
                                                       secsDiscreteOutputs[0].rudder_1_hydraulic_active_mode);
   idUpperRudderElectricModeSolenoidEnergized[0]->set(primsDiscreteOutputs[0].rudder_1_electric_active_mode ||
                                                      secsDiscreteOutputs[0].rudder_1_electric_active_mode);
-  idUpperRudderCommandedPosition[0]->set(primsAnalogOutputs[0].rudder_1_pos_order_deg + secsAnalogOutputs[0].rudder_1_pos_order_deg);
+  idUpperRudderCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].rudder_1_pos_order_deg + secsAnalogOutputsPrevious[0].rudder_1_pos_order_deg,
+                         primsAnalogOutputs[0].rudder_1_pos_order_deg + secsAnalogOutputs[0].rudder_1_pos_order_deg));
   idUpperRudderHydraulicModeSolenoidEnergized[1]->set(primsDiscreteOutputs[1].rudder_1_hydraulic_active_mode ||
                                                       secsDiscreteOutputs[1].rudder_1_hydraulic_active_mode);
   idUpperRudderElectricModeSolenoidEnergized[1]->set(primsDiscreteOutputs[1].rudder_1_electric_active_mode ||
                                                      secsDiscreteOutputs[1].rudder_1_electric_active_mode);
-  idUpperRudderCommandedPosition[1]->set(primsAnalogOutputs[1].rudder_1_pos_order_deg + secsAnalogOutputs[1].rudder_1_pos_order_deg);
+  idUpperRudderCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[1].rudder_1_pos_order_deg + secsAnalogOutputsPrevious[1].rudder_1_pos_order_deg,
+                         primsAnalogOutputs[1].rudder_1_pos_order_deg + secsAnalogOutputs[1].rudder_1_pos_order_deg));
 
   idLowerRudderHydraulicModeSolenoidEnergized[0]->set(primsDiscreteOutputs[0].rudder_2_hydraulic_active_mode ||
                                                       secsDiscreteOutputs[0].rudder_2_hydraulic_active_mode);
   idLowerRudderElectricModeSolenoidEnergized[0]->set(primsDiscreteOutputs[0].rudder_2_electric_active_mode ||
                                                      secsDiscreteOutputs[0].rudder_2_electric_active_mode);
-  idLowerRudderCommandedPosition[0]->set(primsAnalogOutputs[0].rudder_2_pos_order_deg + secsAnalogOutputs[0].rudder_2_pos_order_deg);
+  idLowerRudderCommandedPosition[0]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[0].rudder_2_pos_order_deg + secsAnalogOutputsPrevious[0].rudder_2_pos_order_deg,
+                         primsAnalogOutputs[0].rudder_2_pos_order_deg + secsAnalogOutputs[0].rudder_2_pos_order_deg));
   idLowerRudderHydraulicModeSolenoidEnergized[1]->set(primsDiscreteOutputs[2].rudder_1_hydraulic_active_mode ||
                                                       secsDiscreteOutputs[2].rudder_1_hydraulic_active_mode);
   idLowerRudderElectricModeSolenoidEnergized[1]->set(primsDiscreteOutputs[2].rudder_1_electric_active_mode ||
                                                      secsDiscreteOutputs[2].rudder_1_electric_active_mode);
-  idLowerRudderCommandedPosition[1]->set(primsAnalogOutputs[2].rudder_1_pos_order_deg + secsAnalogOutputs[2].rudder_1_pos_order_deg);
+  idLowerRudderCommandedPosition[1]->set(
+      interpolateCommand(primsAnalogOutputsPrevious[2].rudder_1_pos_order_deg + secsAnalogOutputsPrevious[2].rudder_1_pos_order_deg,
+                         primsAnalogOutputs[2].rudder_1_pos_order_deg + secsAnalogOutputs[2].rudder_1_pos_order_deg));
 
   idRudderTrimActiveModeCommanded[0]->set(secsDiscreteOutputs[0].rudder_trim_active_mode);
-  idRudderTrimCommandedPosition[0]->set(secsAnalogOutputs[0].rudder_trim_pos_order_deg);
+  idRudderTrimCommandedPosition[0]->set(interpolateCommand(secsAnalogOutputsPrevious[0].rudder_trim_pos_order_deg,
+                                                           secsAnalogOutputs[0].rudder_trim_pos_order_deg));
   idRudderTrimActiveModeCommanded[1]->set(secsDiscreteOutputs[2].rudder_trim_active_mode);
-  idRudderTrimCommandedPosition[1]->set(secsAnalogOutputs[2].rudder_trim_pos_order_deg);
+  idRudderTrimCommandedPosition[1]->set(interpolateCommand(secsAnalogOutputsPrevious[2].rudder_trim_pos_order_deg,
+                                                           secsAnalogOutputs[2].rudder_trim_pos_order_deg));
 
   double totalSpoilersLeftDeflection = idLeftSpoilerPosition[0]->get() + idLeftSpoilerPosition[1]->get() + idLeftSpoilerPosition[2]->get() +
                                        idLeftSpoilerPosition[3]->get() + idLeftSpoilerPosition[4]->get() + idLeftSpoilerPosition[5]->get() +
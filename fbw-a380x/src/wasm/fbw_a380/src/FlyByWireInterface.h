@@ -10,6 +10,7 @@
 #include "FlightDataRecorder.h"
 #include "InterpolatingLookupTable.h"
 #include "LocalVariable.h"
+#include "ModelRateGroup.h"
 #include "RateLimiter.h"
 #include "SpoilersHandler.h"
 #include "ThrottleAxisMapping.h"
@@ -63,6 +64,11 @@ class FlyByWireInterface {
   bool autoThrustEnabled = false;
   bool tailstrikeProtectionEnabled = true;
 
+  double autopilotRate = 0;
+  double flightControlsRate = 0;
+  ModelRateGroup autopilotRateGroup;
+  ModelRateGroup flightControlsRateGroup;
+
   bool wasTcasEngaged = false;
 
   bool pauseDetected = false;
@@ -137,11 +143,13 @@ class FlyByWireInterface {
   Prim prims[3] = {Prim(true, false, false), Prim(false, true, false), Prim(false, false, true)};
   base_prim_discrete_outputs primsDiscreteOutputs[3] = {};
   base_prim_analog_outputs primsAnalogOutputs[3] = {};
+  base_prim_analog_outputs primsAnalogOutputsPrevious[3] = {};
   base_prim_out_bus primsBusOutputs[3] = {};
 
   Sec secs[3] = {Sec(true, false, false), Sec(false, true, false), Sec(false, false, true)};
   base_sec_discrete_outputs secsDiscreteOutputs[3] = {};
   base_sec_analog_outputs secsAnalogOutputs[3] = {};
+  base_sec_analog_outputs secsAnalogOutputsPrevious[3] = {};
   base_sec_out_bus secsBusOutputs[3] = {};
   //
   // Fcdc fcdcs[2] = {Fcdc(true), Fcdc(false)};
@@ -308,7 +316,8 @@ class FlyByWireInterface {
   std::unique_ptr<LocalVariable> idThrottlePosition3d_2;
   std::unique_ptr<LocalVariable> idThrottlePosition3d_3;
   std::unique_ptr<LocalVariable> idThrottlePosition3d_4;
-  InterpolatingLookupTable idThrottlePositionLookupTable3d;
+  static constexpr FixedInterpolatingLookupTable<5> idThrottlePositionLookupTable3d{
+      {{-20.0, 0.0}, {0.0, 0.0}, {25.0, 50.0}, {35.0, 75.0}, {45.0, 100.0}}, 0, 100};
 
   std::vector<std::shared_ptr<ThrottleAxisMapping>> throttleAxis;
 
@@ -613,7 +622,10 @@ class FlyByWireInterface {
 
   bool updateFac(double sampleTime, int facIndex);
 
+  void resetModelRateGroups();
+
   bool updateServoSolenoidStatus();
+  double interpolateCommand(double previous, double current);
 
   bool updateSpoilers(double sampleTime);
 
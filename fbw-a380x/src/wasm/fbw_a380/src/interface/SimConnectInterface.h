@@ -387,13 +387,11 @@ class SimConnectInterface {
 
   long pauseState = 0;
 
-  // change to non-static when aileron events can be processed via SimConnect
-  static bool loggingFlightControlsEnabled;
+  bool loggingFlightControlsEnabled = false;
   bool loggingThrottlesEnabled = false;
 
   SimData simData = {};
-  // change to non-static when aileron events can be processed via SimConnect
-  static SimInput simInput;
+  SimInput simInput = {};
   SimInputPitchTrim simInputPitchTrim = {};
   SimInputRudderTrim simInputRudderTrim = {};
   SimInputAutopilot simInputAutopilot = {};
@@ -420,8 +418,7 @@ class SimConnectInterface {
   base_fac_analog_outputs clientDataFacAnalogOutputs = {};
   base_fac_bus clientDataFacBusOutputs = {};
 
-  // change to non-static when aileron events can be processed via SimConnect
-  static double flightControlsKeyChangeAileron;
+  double flightControlsKeyChangeAileron = 0.0;
   double flightControlsKeyChangeElevator = 0.0;
   double flightControlsKeyChangeRudder = 0.0;
   bool disableXboxCompatibilityRudderPlusMinus = false;
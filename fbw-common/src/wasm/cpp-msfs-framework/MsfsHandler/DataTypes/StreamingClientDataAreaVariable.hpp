@@ -4,6 +4,7 @@
 #ifndef FLYBYWIRE_AIRCRAFT_STREAMINGCLIENTDATAAREAVARIABLE_HPP
 #define FLYBYWIRE_AIRCRAFT_STREAMINGCLIENTDATAAREAVARIABLE_HPP
 
+#include "ChunkReassembler.hpp"
 #include "ClientDataAreaVariable.hpp"
 #include "UpdateMode.h"
 
@@ -14,10 +15,12 @@ class DataManager;
  * send and receive data larger than the maximum size of a single SimConnect client data area chunk of 8192 bytes.<p/>
  *
  * The data is split into chunks of a fixed size (8192 bytes) and sent/received in chunks.<br/>
- * The data is stored in a vector of T, which is resized to the number of bytes expected to be received.<p/>
+ * Received chunks are collected by a ChunkReassembler and the data is only replaced when all chunks of a transfer
+ * have been received, so getData() always returns the last complete transfer.<p/>
  *
- * Before receiving data the reserve() method must be called to reset the data and set the number of bytes to be
+ * Before receiving data the reserve() method must be called to start a new transfer and set the number of bytes to be
  * received.<br/>
+ * Chunks with a ChunkHeader (see setChunkHeaders()) are checked for gaps, a transfer with a missing chunk is dropped.<br/>
  *
  * @tparam T the type of the data to be sent/received - e.g. char for string data
  * @tparam ChunkSize the size of the chunks to be sent/received - must be <= 8192. Default is 8192.
@@ -28,17 +31,14 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
   // The data manager is a friend, so it can access the private constructor.
   friend DataManager;
 
-  // the content of the client data area as a vector of T
-  std::vector<T> content;
+  // collects the received chunks and holds the content of the client data area as a vector of T
+  ChunkReassembler<T, ChunkSize> reassembler{};
 
-  // the number of bytes expected to be received - set in reserve()
-  std::size_t expectedByteCount{};
+  // if true the sent chunks start with a ChunkHeader
+  bool chunkHeaders = false;
 
-  // the number of bytes received so far - re-set in reserve()
-  std::size_t receivedBytes{};
-
-  // the number of chunks received so far - re-set in reserve()
-  std::size_t receivedChunks{};
+  // the sequence number of the last transfer sent with chunk headers
+  std::uint32_t transferSequence{};
 
   // hide incompatible methods - alternative would be to make this class independent of ClientDataAreaVariable
   using ClientDataAreaVariable<T>::data;
@@ -76,8 +76,7 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
                                   ChunkSize,
                                   updateMode,
                                   maxAgeTime,
-                                  maxAgeTicks),
-        content() {}
+                                  maxAgeTicks) {}
 
  public:
   StreamingClientDataAreaVariable<T, ChunkSize>() = delete;                                        // no default constructor
@@ -106,50 +105,66 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
    */
   void reserve(std::size_t expectedByteCnt) {
     this->setChanged(false);
-    this->content.clear();
-    this->receivedBytes = 0;
-    this->receivedChunks = 0;
-    this->expectedByteCount = expectedByteCnt;
-    this->content.reserve(expectedByteCnt);
+    reassembler.expect(expectedByteCnt);
   }
 
   void processSimData(const SIMCONNECT_RECV* pData, FLOAT64 simTime, UINT64 tickCounter) override {
     const auto pClientData = reinterpret_cast<const SIMCONNECT_RECV_CLIENT_DATA*>(pData);
 
-    std::size_t remainingBytes = this->expectedByteCount - this->receivedBytes;
-    if (remainingBytes > ChunkSize) {
-      remainingBytes = ChunkSize;
-    }
-
-    // insert the data into the vector - very fast as well but results in a valid vector instance (memcpy doesn't)
-    this->content.insert(this->content.end(), (T*)&pClientData->dwData, (T*)&pClientData->dwData + remainingBytes);
-
-    this->receivedChunks++;
-    this->receivedBytes += remainingBytes;
-
-    // received all data?
-    if (this->receivedBytes >= this->expectedByteCount) {
-      this->updateStamps(simTime, tickCounter);
-      this->setChanged(true);
-      return;
+    switch (reassembler.receive(&pClientData->dwData)) {
+      case ChunkReassembler<T, ChunkSize>::Status::Complete:
+        this->updateStamps(simTime, tickCounter);
+        this->setChanged(true);
+        break;
+      case ChunkReassembler<T, ChunkSize>::Status::Dropped:
+        LOG_WARN("StreamingClientDataAreaVariable: Dropped transfer with missing chunk for " + this->getName());
+        break;
+      default:
+        break;
     }
   }
 
+  /**
+   * Sets if the chunks sent by writeDataToSim() start with a ChunkHeader. The receiver must support
+   * chunk headers, which is the case for all StreamingClientDataAreaVariable instances.
+   * @param enabled true to send chunk headers
+   */
+  void setChunkHeaders(bool enabled) { chunkHeaders = enabled; }
+
   /**
    * Writes the data to the sim by splitting it into chunks of a fixed size (ChunkSize) and sending
    * each chunk separately.<br/>
    * @return true if successful, false otherwise
    */
   bool writeDataToSim() override {
+    std::vector<T>& content = getData();
     [[maybe_unused]] int chunkCount = 0;  // for debugging output only
     std::size_t sentBytes = 0;
-    std::size_t remainingBytes = this->content.size();
+    std::size_t remainingBytes = content.size();
+
+    if (chunkHeaders) {
+      const std::size_t byteCount = content.size() * sizeof(T);
+      transferSequence++;
+      std::array<T, ChunkSize> buffer{};
+      while (sentBytes < byteCount) {
+        sentBytes += ChunkReassembler<T, ChunkSize>::fillChunk(buffer.data(), content.data(), byteCount, transferSequence, sentBytes);
+        chunkCount++;
+        if (!SUCCEEDED(SimConnect_SetClientData(this->hSimConnect, this->clientDataId, this->dataDefId,
+                                                SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, ChunkSize, buffer.data()))) {
+          LOG_ERROR("Setting data to sim for " + this->getName() + " with dataDefId=" + std::to_string(this->dataDefId) + " failed!");
+          return false;
+        }
+      }
+      LOG_DEBUG("Finished sending data in " + std::to_string(chunkCount) + " chunks with headers" +
+                " Sent bytes: " + std::to_string(sentBytes) + " DataSize: " + std::to_string(byteCount));
+      return true;
+    }
 
-    while (sentBytes < this->content.size()) {
+    while (sentBytes < content.size()) {
       if (remainingBytes >= ChunkSize) {
         chunkCount++;
         if (!SUCCEEDED(SimConnect_SetClientData(this->hSimConnect, this->clientDataId, this->dataDefId,
-                                                SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, ChunkSize, &this->content.data()[sentBytes]))) {
+                                                SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, ChunkSize, &content.data()[sentBytes]))) {
           LOG_ERROR("Setting data to sim for " + this->getName() + " with dataDefId=" + std::to_string(this->dataDefId) + " failed!");
           return false;
         }
@@ -157,7 +172,7 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
       } else {  // last chunk
         // use a tmp array buffer to send the remaining bytes
         std::array<T, ChunkSize> buffer{};
-        std::memcpy(buffer.data(), &this->content.data()[sentBytes], remainingBytes);
+        std::memcpy(buffer.data(), &content.data()[sentBytes], remainingBytes);
         chunkCount++;
         if (!SUCCEEDED(SimConnect_SetClientData(this->hSimConnect, this->clientDataId, this->dataDefId,
                                                 SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, ChunkSize, buffer.data()))) {
@@ -166,13 +181,13 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
         }
         sentBytes += remainingBytes;
       }
-      remainingBytes = this->content.size() - sentBytes;
+      remainingBytes = content.size() - sentBytes;
       LOG_VERBOSE("Sending chunk: " + std::to_string(chunkCount) + " Sent bytes: " + std::to_string(sentBytes) +
                   " Remaining bytes: " + std::to_string(remainingBytes));
     }
 
     LOG_DEBUG("Finished sending data in " + std::to_string(chunkCount) + " chunks" + " Sent bytes: " + std::to_string(sentBytes) +
-              " Remaining bytes: " + std::to_string(remainingBytes) + " DataSize: " + std::to_string(this->content.size()));
+              " Remaining bytes: " + std::to_string(remainingBytes) + " DataSize: " + std::to_string(content.size()));
     return true;
   }
 
@@ -180,25 +195,25 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
    * Returns a modifiable reference to the data container
    * @return T& Reference to the data container
    */
-  [[nodiscard]] std::vector<T>& getData() { return content; }
+  [[nodiscard]] std::vector<T>& getData() { return reassembler.data(); }
 
   /**
    * Returns a constant reference to the data container
    * @return std::vector<T>& Reference to the data container
    */
-  [[nodiscard]] const std::vector<T>& getData() const { return content; }
+  [[nodiscard]] const std::vector<T>& getData() const { return reassembler.data(); }
 
   /**
    * Returns the number of bytes received so far
    * @return std::size_t Number of bytes received so far
    */
-  [[nodiscard]] std::size_t getReceivedBytes() const { return receivedBytes; }
+  [[nodiscard]] std::size_t getReceivedBytes() const { return reassembler.getReceivedBytes(); }
 
   /**
    * Returns the number of chunks received so far
    * @return std::size_t Number of chunks received so far
    */
-  [[nodiscard]] std::size_t getReceivedChunks() const { return receivedChunks; }
+  [[nodiscard]] std::size_t getReceivedChunks() const { return reassembler.getReceivedChunks(); }
 
   [[nodiscard]] std::string str() const override {
     std::stringstream ss;
@@ -206,10 +221,11 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
     ss << ", clientDataId=" << this->clientDataId;
     ss << ", dataDefId=" << this->dataDefId;
     ss << ", requestId=" << this->requestId;
-    ss << ", expectedByteCount=" << this->expectedByteCount;
-    ss << ", receivedBytes=" << this->receivedBytes;
-    ss << ", receivedChunks=" << this->receivedChunks;
-    ss << ", structSize=" << content.size() * sizeof(T);
+    ss << ", expectedByteCount=" << reassembler.getExpectedBytes();
+    ss << ", receivedBytes=" << reassembler.getReceivedBytes();
+    ss << ", receivedChunks=" << reassembler.getReceivedChunks();
+    ss << ", droppedTransfers=" << reassembler.getDroppedTransfers();
+    ss << ", structSize=" << getData().size() * sizeof(T);
     ss << ", timeStamp: " << this->timeStampSimTime;
     ss << ", nextUpdateTimeStamp: " << this->nextUpdateTimeStamp;
     ss << ", tickStamp: " << this->tickStamp;
@@ -220,7 +236,7 @@ class StreamingClientDataAreaVariable : public ClientDataAreaVariable<T> {
     ss << ", autoWrite: " << this->isAutoWrite();
     ss << ", maxAgeTime: " << this->maxAgeTime;
     ss << ", maxAgeTicks: " << this->maxAgeTicks;
-    ss << ", dataType=" << typeid(T).name() << "::" << quote(content);
+    ss << ", dataType=" << typeid(T).name() << "::" << quote(getData());
     ss << "]";
     return ss.str();
   }
@@ -0,0 +1,203 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_CHUNKREASSEMBLER_HPP
+#define FLYBYWIRE_AIRCRAFT_CHUNKREASSEMBLER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Optional header in front of the payload of each chunk of a streamed transfer.<p/>
+ *
+ * All chunks of one transfer carry the same sequence number and the byte offset of their payload within the
+ * transfer. This allows the receiver to detect lost, repeated or stale chunks.
+ */
+struct ChunkHeader {
+  std::uint32_t magic;
+  std::uint32_t sequence;
+  std::uint32_t offset;
+};
+
+/**
+ * @brief Reassembles data that is streamed in fixed size chunks through a SimConnect client data area.<p/>
+ *
+ * The size of a transfer is announced separately (e.g. in a meta data client data area) and passed to expect() before
+ * the first chunk arrives. The chunks are collected in a receive buffer and only swapped into the data buffer when the
+ * transfer is complete, so the data buffer always holds the last complete transfer and is never overwritten by a
+ * partially received one.<p/>
+ *
+ * Chunks starting with a ChunkHeader are placed at their offset, and a transfer with a missing or out of order chunk is
+ * dropped instead of being delivered corrupted. Chunks without a header are appended in the order they arrive as the
+ * sender does not provide the information to detect gaps.
+ *
+ * @tparam T the element type of the data - must be trivially copyable
+ * @tparam ChunkSize the size of a chunk in bytes
+ */
+template <typename T, std::size_t ChunkSize>
+class ChunkReassembler {
+  static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+  static_assert(ChunkSize > sizeof(ChunkHeader), "ChunkSize must be larger than the chunk header");
+
+ public:
+  // magic number identifying a chunk with a ChunkHeader ("CHNK" in little endian)
+  static constexpr std::uint32_t CHUNK_HEADER_MAGIC = 0x4b4e4843;
+  // the number of payload bytes in a chunk with a ChunkHeader
+  static constexpr std::size_t PAYLOAD_SIZE = ChunkSize - sizeof(ChunkHeader);
+
+  enum class Status {
+    // the chunk was added and the transfer needs more chunks
+    Incomplete,
+    // the chunk completed the transfer which is now available in data()
+    Complete,
+    // the chunk did not fit the transfer and the transfer was dropped
+    Dropped,
+    // no transfer is expected or the chunk belongs to an older transfer
+    Ignored
+  };
+
+ private:
+  std::vector<T> receiveBuffer{};
+  std::vector<T> dataBuffer{};
+
+  std::size_t expectedByteCount{};
+  std::size_t receivedByteCount{};
+  std::size_t receivedChunkCount{};
+  std::size_t droppedTransferCount{};
+  std::uint32_t sequence{};
+  bool receiving = false;
+  bool withHeaders = false;
+
+  void drop() {
+    receiving = false;
+    droppedTransferCount++;
+  }
+
+ public:
+  /**
+   * @brief Starts a new transfer of the given size.<p/>
+   * An incomplete previous transfer is discarded, the data of the last complete transfer stays available.
+   * @param byteCount the number of bytes of the transfer
+   */
+  void expect(std::size_t byteCount) {
+    expectedByteCount = byteCount;
+    receivedByteCount = 0;
+    receivedChunkCount = 0;
+    receiving = true;
+    // reuses the capacity of the buffer swapped out by the previous transfer
+    receiveBuffer.resize((byteCount + sizeof(T) - 1) / sizeof(T));
+  }
+
+  /**
+   * @brief Adds a received chunk to the current transfer.
+   * @param chunk pointer to the ChunkSize bytes of the chunk
+   * @return the status of the transfer after this chunk
+   */
+  Status receive(const void* chunk) {
+    if (!receiving) {
+      return Status::Ignored;
+    }
+
+    auto bytes = static_cast<const std::uint8_t*>(chunk);
+    ChunkHeader header{};
+    std::memcpy(&header, bytes, sizeof(header));
+    const bool hasHeader = header.magic == CHUNK_HEADER_MAGIC;
+
+    std::size_t offset = receivedByteCount;
+    std::size_t payloadSize = ChunkSize;
+    if (receivedChunkCount == 0) {
+      // the remaining chunks of an interrupted transfer may still arrive after the new one was announced
+      if (hasHeader && header.offset != 0) {
+        return Status::Ignored;
+      }
+      withHeaders = hasHeader;
+      sequence = header.sequence;
+    }
+    if (withHeaders) {
+      if (!hasHeader) {
+        drop();
+        return Status::Dropped;
+      }
+      // stale chunks of a previous transfer are skipped, a missing chunk drops the transfer
+      if (header.sequence != sequence) {
+        return Status::Ignored;
+      }
+      if (header.offset != receivedByteCount) {
+        drop();
+        return Status::Dropped;
+      }
+      offset = header.offset;
+      payloadSize = PAYLOAD_SIZE;
+      bytes += sizeof(header);
+    }
+
+    const std::size_t copyBytes = std::min(expectedByteCount - offset, payloadSize);
+    std::memcpy(reinterpret_cast<std::uint8_t*>(receiveBuffer.data()) + offset, bytes, copyBytes);
+    receivedByteCount += copyBytes;
+    receivedChunkCount++;
+
+    if (receivedByteCount < expectedByteCount) {
+      return Status::Incomplete;
+    }
+
+    std::swap(receiveBuffer, dataBuffer);
+    receiving = false;
+    return Status::Complete;
+  }
+
+  /**
+   * @brief Fills a chunk with a ChunkHeader and the next part of the data.
+   * @param chunk pointer to the ChunkSize bytes of the chunk to fill
+   * @param data the data of the transfer
+   * @param byteCount the number of bytes of the transfer
+   * @param transferSequence the sequence number of the transfer
+   * @param offset the offset of the chunk's payload in bytes
+   * @return the number of payload bytes in the chunk
+   */
+  static std::size_t fillChunk(void* chunk, const T* data, std::size_t byteCount, std::uint32_t transferSequence, std::size_t offset) {
+    const ChunkHeader header{CHUNK_HEADER_MAGIC, transferSequence, static_cast<std::uint32_t>(offset)};
+    const std::size_t payloadBytes = std::min(byteCount - offset, PAYLOAD_SIZE);
+    auto bytes = static_cast<std::uint8_t*>(chunk);
+    std::memcpy(bytes, &header, sizeof(header));
+    std::memcpy(bytes + sizeof(header), reinterpret_cast<const std::uint8_t*>(data) + offset, payloadBytes);
+    std::memset(bytes + sizeof(header) + payloadBytes, 0, PAYLOAD_SIZE - payloadBytes);
+    return payloadBytes;
+  }
+
+  /**
+   * @return a modifiable reference to the data of the last complete transfer
+   */
+  [[nodiscard]] std::vector<T>& data() { return dataBuffer; }
+
+  /**
+   * @return a constant reference to the data of the last complete transfer
+   */
+  [[nodiscard]] const std::vector<T>& data() const { return dataBuffer; }
+
+  /**
+   * @return the number of bytes expected for the current transfer
+   */
+  [[nodiscard]] std::size_t getExpectedBytes() const { return expectedByteCount; }
+
+  /**
+   * @return the number of bytes received for the current or last transfer
+   */
+  [[nodiscard]] std::size_t getReceivedBytes() const { return receivedByteCount; }
+
+  /**
+   * @return the number of chunks received for the current or last transfer
+   */
+  [[nodiscard]] std::size_t getReceivedChunks() const { return receivedChunkCount; }
+
+  /**
+   * @return the number of transfers dropped because of a missing chunk
+   */
+  [[nodiscard]] std::size_t getDroppedTransfers() const { return droppedTransferCount; }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_CHUNKREASSEMBLER_HPP
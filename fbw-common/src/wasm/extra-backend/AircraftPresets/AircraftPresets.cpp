@@ -1,6 +1,7 @@
 // Copyright (c) 2023 FlyByWire Simulations
 // SPDX-License-Identifier: GPL-3.0
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -34,6 +35,7 @@
 //
 // In addition, the AircraftPresets module is a very specific use case amd uses
 // SimConnect execute_calculator_code extensively for the procedures to work.
+// The calculator code is precompiled once on initialization.
 // This is a good demonstration that the Cpp WASM framework does not limit
 // applications to a specific pattern.
 ///
@@ -55,6 +57,10 @@ bool AircraftPresets::initialize() {
   // Simvars
   simOnGround = dataManager->make_simple_aircraft_var("SIM ON GROUND", UNITS.Number, true);
 
+  // parse the calculator code of the procedures only once instead of every time a step is executed
+  const std::size_t compiledCount = presetProcedures.precompileCalculatorCode();
+  LOG_INFO("AircraftPresets: Precompiled " + std::to_string(compiledCount) + " calculator code strings");
+
   _isInitialized = true;
   LOG_INFO("AircraftPresets initialized");
   return true;
@@ -139,15 +145,14 @@ bool AircraftPresets::update(sGaugeDrawData* pData) {
     // calculate next delay
     currentDelay = currentLoadingTime + currentStepPtr->delayAfter;
 
-    // prepare return values for execute_calculator_code
-    FLOAT64 fvalue = 0.0;
-    SINT32 ivalue = 0;
-    PCSTRINGZ svalue = nullptr;
-
     // check if the current step is a condition step and check the condition
     if (currentStepPtr->isConditional) {
+      // prepare return values for execute_calculator_code
+      FLOAT64 fvalue = 0.0;
+      SINT32 ivalue = 0;
+      PCSTRINGZ svalue = nullptr;
       updateProgress(currentStepPtr);
-      execute_calculator_code(currentStepPtr->actionCode.c_str(), &fvalue, &ivalue, &svalue);
+      execute_calculator_code(presetProcedures.getCalculatorCode(currentStepPtr->actionCode), &fvalue, &ivalue, &svalue);
       LOG_INFO("AircraftPresets: Aircraft Preset Step " + std::to_string(currentStep) + " Condition: " + currentStepPtr->description +
                " (delay between tests: " + std::to_string(currentStepPtr->delayAfter) + ")");
       if (!helper::Math::almostEqual(0.0, fvalue)) {
@@ -157,40 +162,24 @@ bool AircraftPresets::update(sGaugeDrawData* pData) {
       return true;
     }
 
-    // allow execution of the procedure without a delay if expedite is set
-    if (aircraftPresetExpedite->getAsBool() && !currentStepPtr->noExpedite) {
-      currentDelay = currentLoadingTime + aircraftPresetExpediteDelay->get();
-    }
-
-    // test if the next step is required or if the state is already set in
-    // which case the action can be skipped, and delay can be ignored.
-    fvalue = 0;
-    ivalue = 0;
-    svalue = nullptr;
-    if (!currentStepPtr->expectedStateCheckCode.empty()) {
-      if (aircraftPresetVerbose->getAsBool()) {
-        std::cout << "AircraftPresets: Aircraft Preset Step " << currentStep << " Test: " << currentStepPtr->description << " TEST: \""
-                  << currentStepPtr->expectedStateCheckCode << "\"" << std::endl;
-      }
-      execute_calculator_code(currentStepPtr->expectedStateCheckCode.c_str(), &fvalue, &ivalue, &svalue);
-      if (!helper::Math::almostEqual(0.0, fvalue)) {
-        if (aircraftPresetVerbose->getAsBool()) {
-          std::cout << "AircraftPresets: Aircraft Preset Step " << currentStep << " Skipping: " << currentStepPtr->description
-                    << " TEST: \"" << currentStepPtr->expectedStateCheckCode << "\"" << std::endl;
-        }
-        currentDelay = 0;
-        currentStep++;
-        return true;
+    // execute the step and all following steps of the same parallel group in this frame
+    // and wait for the longest delay of the executed steps
+    bool executed = false;
+    double delayAfter = 0;
+    do {
+      currentStepPtr = (*currentProcedure)[currentStep];
+      // allow execution of the procedure without a delay if expedite is set
+      const bool expedite = aircraftPresetExpedite->getAsBool() && !currentStepPtr->noExpedite;
+      const double stepDelay = expedite ? aircraftPresetExpediteDelay->get() : currentStepPtr->delayAfter;
+      if (executeStep(currentStepPtr, stepDelay)) {
+        executed = true;
+        delayAfter = (std::max)(delayAfter, stepDelay);
       }
-    }
-
-    updateProgress(currentStepPtr);
+      currentStep++;
+    } while (currentStep < currentProcedure->size() && isSameParallelGroup(currentStepPtr, (*currentProcedure)[currentStep]));
 
-    // execute code to set expected state
-    LOG_INFO("AircraftPresets: Aircraft Preset Step " + std::to_string(currentStep) + " Execute: " + currentStepPtr->description +
-             " (delay after: " + std::to_string(static_cast<int>(currentDelay - currentLoadingTime)) + ")");
-    execute_calculator_code(currentStepPtr->actionCode.c_str(), &fvalue, &ivalue, &svalue);
-    currentStep++;
+    // skipped steps do not need a delay
+    currentDelay = executed ? currentLoadingTime + delayAfter : 0;
 
   } else if (loadingIsActive) {
     // request lvar has been set to 0 while we were executing a procedure ==> cancel loading
@@ -211,6 +200,42 @@ bool AircraftPresets::shutdown() {
 // Private methods
 // ==============================================================================
 
+bool AircraftPresets::isSameParallelGroup(const ProcedureStep* step, const ProcedureStep* nextStep) {
+  return step->parallelGroup != 0 && step->parallelGroup == nextStep->parallelGroup && !nextStep->isConditional;
+}
+
+bool AircraftPresets::executeStep(const ProcedureStep* stepPtr, double delayAfter) {
+  // prepare return values for execute_calculator_code
+  FLOAT64 fvalue = 0.0;
+  SINT32 ivalue = 0;
+  PCSTRINGZ svalue = nullptr;
+
+  // test if the step is required or if the state is already set in
+  // which case the action can be skipped, and delay can be ignored.
+  if (!stepPtr->expectedStateCheckCode.empty()) {
+    if (aircraftPresetVerbose->getAsBool()) {
+      std::cout << "AircraftPresets: Aircraft Preset Step " << currentStep << " Test: " << stepPtr->description << " TEST: \""
+                << stepPtr->expectedStateCheckCode << "\"" << std::endl;
+    }
+    execute_calculator_code(presetProcedures.getCalculatorCode(stepPtr->expectedStateCheckCode), &fvalue, &ivalue, &svalue);
+    if (!helper::Math::almostEqual(0.0, fvalue)) {
+      if (aircraftPresetVerbose->getAsBool()) {
+        std::cout << "AircraftPresets: Aircraft Preset Step " << currentStep << " Skipping: " << stepPtr->description << " TEST: \""
+                  << stepPtr->expectedStateCheckCode << "\"" << std::endl;
+      }
+      return false;
+    }
+  }
+
+  updateProgress(stepPtr);
+
+  // execute code to set expected state
+  LOG_INFO("AircraftPresets: Aircraft Preset Step " + std::to_string(currentStep) + " Execute: " + stepPtr->description +
+           " (delay after: " + std::to_string(static_cast<int>(delayAfter)) + ")");
+  execute_calculator_code(presetProcedures.getCalculatorCode(stepPtr->actionCode), &fvalue, &ivalue, &svalue);
+  return true;
+}
+
 void AircraftPresets::updateProgress(const ProcedureStep* currentStepPtr) const {
   const FLOAT64 loadPercentage = static_cast<double>(currentStep) / currentProcedure->size();
 
@@ -51,8 +51,8 @@ class AircraftPresets : public Module {
   // Sim-vars
   AircraftVariablePtr simOnGround{};
 
-  // Procedures
-  const PresetProcedures presetProcedures;
+  // Procedures - the calculator code of the steps is precompiled in initialize()
+  PresetProcedures presetProcedures;
 
   // current procedure ID
   int currentProcedureID = 0;
@@ -85,6 +85,22 @@ class AircraftPresets : public Module {
   bool shutdown() override;
 
  private:
+  /**
+   * Checks if a step can be executed in the same frame as the previous step.
+   * @param step The previous step.
+   * @param nextStep The step following the previous step in the procedure.
+   * @return true if both steps belong to the same parallel group and the next step is not a condition
+   */
+  static bool isSameParallelGroup(const ProcedureStep* step, const ProcedureStep* nextStep);
+
+  /**
+   * Executes the action of a non-conditional step unless its expected state is already set.
+   * @param stepPtr The step to execute.
+   * @param delayAfter The delay after the step in ms - used for logging only.
+   * @return true if the action has been executed, false if it has been skipped
+   */
+  bool executeStep(const ProcedureStep* stepPtr, double delayAfter);
+
   /**
    * Updates the progress of the preset load and send it to the Lvars and the flyPad via COMM_BUS
    * @param currentStepPtr The current step of the procedure.
@@ -6,7 +6,11 @@
 #include <algorithm>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
+
+#include <MSFS/Legacy/gauges.h>
+
 #include "PresetProceduresDefinition.h"
 #include "ProcedureStep.h"
 
@@ -20,6 +24,9 @@ typedef std::vector<const ProcedureStep*> Procedure;
 /**
  * The PresetProcedures class loads the procedure definitions from the PresetProceduresDefinition
  * and provides the procedures for the different configurations of the aircraft.<p/>
+ *
+ * The calculator code of the procedure steps can be precompiled once, so the sim does not need to
+ * parse the code every time a step is executed or a condition is checked.<p/>
  */
 class PresetProcedures {
 
@@ -33,6 +40,21 @@ class PresetProcedures {
     std::transform(begin(src), end(src), back_inserter(dest), [](const auto& procedure) { return &procedure; });
   }
 
+  // precompiled calculator code - the key is the address of the code string in the procedure step
+  std::unordered_map<const std::string*, std::string> compiledCode{};
+
+  void precompile(const std::string& code) {
+    if (code.empty() || compiledCode.find(&code) != compiledCode.end()) {
+      return;
+    }
+    PCSTRINGZ compiled = nullptr;
+    UINT32 compiledSize = 0;
+    if (gauge_calculator_code_precompile(&compiled, &compiledSize, code.c_str()) && compiled != nullptr) {
+      // the compiled code is returned in a buffer of the sim, which is reused by the next call
+      compiledCode.emplace(&code, std::string(compiled, compiledSize));
+    }
+  }
+
 #ifdef DEBUG
   static inline void printProcedure(const ProcedureDefinition& procedures) {
     for (const auto& p : procedures) {
@@ -83,6 +105,32 @@ class PresetProcedures {
     insert(readyForTakeoff, proceduresDefinition.TAKEOFF_CONFIG_ON);
   }
 
+  /**
+   * Precompiles the calculator code of all procedure steps.<p/>
+   * Steps shared by several procedures are only compiled once. Code that cannot be precompiled
+   * is executed from its source.
+   * @return the number of precompiled code strings
+   */
+  std::size_t precompileCalculatorCode() {
+    for (const Procedure* procedure : {&coldAndDark, &powered, &readyForPushback, &readyForTaxi, &readyForTakeoff}) {
+      for (const ProcedureStep* step : *procedure) {
+        precompile(step->expectedStateCheckCode);
+        precompile(step->actionCode);
+      }
+    }
+    return compiledCode.size();
+  }
+
+  /**
+   * Returns the code to pass to execute_calculator_code for a calculator code string of a procedure step.
+   * @param code the expectedStateCheckCode or actionCode of a procedure step
+   * @return the precompiled code or the source code if it has not been precompiled
+   */
+  [[nodiscard]] PCSTRINGZ getCalculatorCode(const std::string& code) const {
+    const auto compiled = compiledCode.find(&code);
+    return compiled != compiledCode.end() ? compiled->second.c_str() : code.c_str();
+  }
+
   [[nodiscard]] std::optional<const Procedure*> getProcedure(int64_t pID) const {
     switch (pID) {
       case 1:
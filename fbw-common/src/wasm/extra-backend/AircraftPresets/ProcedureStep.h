@@ -16,6 +16,8 @@
  * @field expectedStateCheckCode Check if desired state is already set so the action can be skipped
  * @field actionCode Calculator code to achieve the desired state. If it is a conditional this calculator code needs to eval to true or false
  * @field noExpedite If true, the step will not be expedited even if expedite is set (default: false)
+ * @field parallelGroup Consecutive non-conditional steps with the same non-zero group do not depend on each other and
+ *                      are executed in the same frame, followed by the longest delay of the group (default: 0 - no group)
  */
 struct ProcedureStep {
   std::string description;
@@ -25,6 +27,7 @@ struct ProcedureStep {
   std::string expectedStateCheckCode;
   std::string actionCode;
   bool noExpedite = false;
+  int parallelGroup = 0;
 };
 
 #endif  // FLYBYWIRE_AIRCRAFT_PROCEDURESTEP_H
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0
 
 #include <algorithm>
+#include <utility>
 
 #include "LightingPresets.h"
 #include "ScopedTimer.hpp"
@@ -22,6 +23,17 @@ bool LightingPresets::initialize() {
 
   initialize_aircraft();
 
+  // the presets are read from the ini file only once and kept in memory afterwards
+  if (!iniFile.read(ini)) {
+    LOG_WARN("LightingPresets: Could not read ini file - starting without stored presets");
+  }
+
+  const std::size_t size = lightingVariables.size();
+  currentLightValues.resize(size);
+  startLightValues.resize(size);
+  loadedLightValues.resize(size);
+  intermediateLightValues.resize(size);
+
   _isInitialized = true;
   LOG_INFO("LightingPresets initialized");
   return true;
@@ -45,20 +57,24 @@ bool LightingPresets::update([[maybe_unused]] sGaugeDrawData* pData) {
 
   // load has priority in case both vars are set.
   if (const INT64 presetRequest = loadLightingPresetRequest->getAsInt64()) {
-    if (readIniFile) {
+    if (loadingPreset != presetRequest) {
       LOG_INFO("LightingPresets_A32NX: Lighting Preset: " + std::to_string(presetRequest) + " is being loaded.");
     }
     // loading a preset happens over a number of frames to allow the animation to keep up
     // loadLightingPreset() returns true when the preset is fully loaded
     // otherwise it returns false and the next frame will continue loading
     if (loadLightingPreset(presetRequest)) {
-      readIniFile = true;
+      loadingPreset = 0;
       loadLightingPresetRequest->setAsInt64(0);
       LOG_INFO("LightingPresets_A32NX: Lighting Preset: " + std::to_string(presetRequest) + " successfully loaded.");
     }
-  } else if (saveLightingPresetRequest->getAsBool()) {
-    saveLightingPreset(saveLightingPresetRequest->getAsInt64());
-    saveLightingPresetRequest->setAsInt64(0);
+  } else {
+    // a load request reset before the preset was fully loaded starts from the current values again next time
+    loadingPreset = 0;
+    if (saveLightingPresetRequest->getAsBool()) {
+      saveLightingPreset(saveLightingPresetRequest->getAsInt64());
+      saveLightingPresetRequest->setAsInt64(0);
+    }
   }
 
   return true;
@@ -71,63 +87,104 @@ bool LightingPresets::shutdown() {
 }
 
 bool LightingPresets::loadLightingPreset(INT64 loadPresetRequest) {
+  // A new request starts from the current values in the aircraft. This also restarts the loading if
+  // the request changes while a preset is still being loaded.
+  if (loadingPreset != loadPresetRequest) {
+    readFromAircraft();
+    startLightValues = currentLightValues;
+    loadedLightValues = getPreset(loadPresetRequest);
+    loadingPreset = loadPresetRequest;
+    loadingStartTime = msfsHandler.getTimeStamp();
+    lastUpdate = 0.0;
+  }
+
   // Throttle the load process so animation can keep up
-  // Compensates for the fact that the sim runs at different frame rates on different machines
-  // Compensation is imperfect as we need a minimum step size to make the values converge and also
-  // a maximum step size to avoid the animation being choppy.
-  // The reason is that the sim cuts of precision from the LIGHT POTENTIOMETER values we read from
-  // the sim so that the values we write back to the sim are not identical to the values we read
-  // from the sim.
-  const FLOAT64 deltaTime = msfsHandler.getTimeStamp() - lastUpdate;
-  if (deltaTime < UPDATE_DELAY_TIME) {
+  if (msfsHandler.getTimeStamp() - lastUpdate < UPDATE_DELAY_TIME) {
     return false;
   }
-  const FLOAT64 partialLoad = presetLoadTime->get() / deltaTime;
-  FLOAT64 stepSize = std::clamp((100 / partialLoad), MIN_STEP_SIZE, MAX_STEP_SIZE);
   lastUpdate = msfsHandler.getTimeStamp();
 
-  // Read current values to be able to calculate intermediate values which are then applied to the aircraft
-  // Once the intermediate values are identical to the target values then the load is finished
-  readFromAircraft();
-  if (readFromStore(loadPresetRequest)) {
-    const bool finished = calculateIntermediateValues(stepSize);
-    applyToAircraft();
-    return finished;
+  // The intermediate values are interpolated from the values at the start of the loading process
+  // by the elapsed loading time. Compared to converging the values read back from the sim this
+  // is independent of the frame rate and the precision the sim cuts off from the values.
+  const FLOAT64 loadTime = presetLoadTime->get();
+  const FLOAT64 progress = loadTime > 0.0 ? std::clamp((lastUpdate - loadingStartTime) / loadTime, 0.0, 1.0) : 1.0;
+  for (std::size_t i = 0; i < lightingVariables.size(); i++) {
+    intermediateLightValues[i] = lightingVariables[i].interpolate
+                                     ? startLightValues[i] + (loadedLightValues[i] - startLightValues[i]) * progress
+                                     : loadedLightValues[i];
   }
-  LOG_WARN("LightingPresets_A32NX: Loading Lighting Preset: " + std::to_string(loadPresetRequest) + " failed.");
-  return true;
+  applyToAircraft();
+  return progress >= 1.0;
 }
 
 void LightingPresets::saveLightingPreset(INT64 savePresetRequest) {
-  std::cout << "LightingPresets_A32NX: Save to Lighting Preset: " << savePresetRequest << std::endl;
+  std::cout << "LightingPresets: Save to Lighting Preset: " << savePresetRequest << std::endl;
   readFromAircraft();
   if (saveToStore(savePresetRequest)) {
-    LOG_INFO("LightingPresets_A32NX: Lighting Preset: " + std::to_string(savePresetRequest) + " successfully saved.");
+    LOG_INFO("LightingPresets: Lighting Preset: " + std::to_string(savePresetRequest) + " successfully saved.");
     return;
   }
-  LOG_WARN("LightingPresets_A32NX: Saving Lighting Preset: " + std::to_string(savePresetRequest) + " failed.");
+  LOG_WARN("LightingPresets: Saving Lighting Preset: " + std::to_string(savePresetRequest) + " failed.");
+}
+
+std::size_t LightingPresets::addLightingVariable(const CacheableVariablePtr& variable,
+                                                 const std::string& iniKey,
+                                                 FLOAT64 defaultValue,
+                                                 FLOAT64 scale,
+                                                 bool interpolate) {
+  lightingVariables.push_back({variable, iniKey, defaultValue, scale, interpolate});
+  return lightingVariables.size() - 1;
 }
 
-bool LightingPresets::readFromStore(INT64 presetNr) {
-  // only read ini file from disk if we load a new preset
-  if (readIniFile) {
-    if (!iniFile.read(ini)) {
-      LOG_ERROR("LightingPresets_A32NX: Could not read ini file");
-      return false;
-    };
-    readIniFile = false;
+void LightingPresets::readFromAircraft() {
+  for (std::size_t i = 0; i < lightingVariables.size(); i++) {
+    currentLightValues[i] = lightingVariables[i].variable->readFromSim() * lightingVariables[i].scale;
+  }
+}
+
+void LightingPresets::applyToAircraft() {
+  // set() only marks a variable dirty if its value has changed, so unchanged variables are not written
+  for (std::size_t i = 0; i < lightingVariables.size(); i++) {
+    lightingVariables[i].variable->set(intermediateLightValues[i] / lightingVariables[i].scale);
+    lightingVariables[i].variable->updateToSim();
   }
-  loadFromIni(ini, "preset " + std::to_string(presetNr));
-  return true;
+}
+
+const LightingValues& LightingPresets::getPreset(INT64 presetNr) {
+  if (const auto preset = presets.find(presetNr); preset != presets.end()) {
+    return preset->second;
+  }
+
+  // not yet in memory - read from the ini image once
+  // if the preset does not exist in the ini file the default values are used
+  const std::string iniSectionName = "preset " + std::to_string(presetNr);
+  LightingValues values(lightingVariables.size());
+  for (std::size_t i = 0; i < lightingVariables.size(); i++) {
+    values[i] = iniGetOrDefault(ini, iniSectionName, lightingVariables[i].iniKey, lightingVariables[i].defaultValue);
+  }
+  return presets.insert_or_assign(presetNr, std::move(values)).first->second;
 }
 
 bool LightingPresets::saveToStore(INT64 presetNr) {
-  // add/update iniSectionName
+  presets.insert_or_assign(presetNr, currentLightValues);
+
+  // add/update iniSectionName in the ini image and write it to the file
   const std::string iniSectionName = "preset " + std::to_string(presetNr);
-  saveToIni(ini, iniSectionName);
+  for (std::size_t i = 0; i < lightingVariables.size(); i++) {
+    ini[iniSectionName][lightingVariables[i].iniKey] = std::to_string(currentLightValues[i]);
+  }
   return iniFile.write(ini, true);
 }
 
+[[maybe_unused]] std::string LightingPresets::str() const {
+  std::ostringstream os;
+  for (std::size_t i = 0; i < lightingVariables.size(); i++) {
+    os << lightingVariables[i].iniKey << ": " << intermediateLightValues[i] << std::endl;
+  }
+  return os.str();
+}
+
 AircraftVariablePtr LightingPresets::createLightPotentiometerVar(int index) const {
   return dataManager->make_aircraft_var("LIGHT POTENTIOMETER", index, "", lightPotentiometerSetEvent, UNITS.Percent);
 }
@@ -147,15 +204,3 @@ FLOAT64 LightingPresets::iniGetOrDefault(const mINI::INIStructure& ini,
   }
   return defaultValue;
 }
-
-FLOAT64 LightingPresets::convergeValue(FLOAT64 momentary, const FLOAT64 target, FLOAT64 stepSize) {
-  FLOAT64 convergedValue;
-  if (helper::Math::almostEqual(momentary, target, stepSize)) {
-    convergedValue = target;
-  } else if (momentary < target) {
-    convergedValue = (std::min)(momentary + stepSize, target);
-  } else {
-    convergedValue = (std::max)(momentary - stepSize, target);
-  }
-  return convergedValue;
-}
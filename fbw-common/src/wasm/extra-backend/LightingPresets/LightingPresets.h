@@ -4,12 +4,38 @@
 #ifndef FLYBYWIRE_AIRCRAFT_LIGHTINGPRESETS_H
 #define FLYBYWIRE_AIRCRAFT_LIGHTINGPRESETS_H
 
+#include <map>
 #include <string_view>
+#include <vector>
 
 #include "DataManager.h"
 #include "Module.h"
 #include "inih/ini.h"
 
+/**
+ * Describes one lighting variable of an aircraft in the fixed layout of the lighting values.
+ *
+ * The layout is defined once when the module is initialized and the lighting values of a preset are
+ * stored as a vector with one value per variable in the order of the layout. This way loading, saving
+ * and interpolating a preset only iterates over plain values and never needs to look up variables or
+ * ini keys by name.
+ */
+struct LightingVariable {
+  // the variable in the aircraft
+  CacheableVariablePtr variable;
+  // the key of the value in the ini file section of a preset
+  std::string iniKey;
+  // the normalized value used if a preset does not contain the variable
+  FLOAT64 defaultValue;
+  // factor to convert the value of the variable to the normalized range 0..100
+  FLOAT64 scale;
+  // if false the preset value is applied directly instead of being interpolated (e.g. for switches)
+  bool interpolate;
+};
+
+// Normalized lighting values in the order of the lighting variables layout
+using LightingValues = std::vector<FLOAT64>;
+
 class LightingPresets : public Module {
  public:
   LightingPresets() = delete;
@@ -17,9 +43,6 @@ class LightingPresets : public Module {
  protected:
   const std::string CONFIGURATION_FILEPATH = "\\work\\InteriorLightingPresets.ini";
   static constexpr SIMCONNECT_NOTIFICATION_GROUP_ID NOTIFICATION_GROUP_1 = 1;
-  // dynamic step size for convergence
-  static constexpr FLOAT64 MIN_STEP_SIZE = 1.05; // needs to be >=1 as otherwise the value will never converge due to the sim cutting off the decimals
-  static constexpr FLOAT64 MAX_STEP_SIZE = 10.0; // first step is always large therefore we need to limit the max step size
   static constexpr FLOAT64 TOTAL_LOADING_TIME = 2.0;
   static constexpr FLOAT64 UPDATE_DELAY_TIME = 0.15; // delay between updates in seconds - too long would make the animation choppy
 
@@ -38,15 +61,29 @@ class LightingPresets : public Module {
   NamedVariablePtr saveLightingPresetRequest;
   NamedVariablePtr presetLoadTime; // how long shall the preset loading take
 
-  // create ini file and data structure
+  // The fixed layout of the lighting values - defined by the aircraft during initialization
+  std::vector<LightingVariable> lightingVariables{};
+
+  // The current lighting values in the aircraft
+  LightingValues currentLightValues{};
+  // The lighting values in the aircraft when the loading of a preset started
+  LightingValues startLightValues{};
+  // The lighting values of the preset being loaded
+  LightingValues loadedLightValues{};
+  // The lighting values interpolated between the start and the preset values
+  LightingValues intermediateLightValues{};
+
+  // the preset currently being loaded (0 if none) and the time stamp when the loading started
+  INT64 loadingPreset = 0;
+  FLOAT64 loadingStartTime = 0.0;
+
+  // The presets already read from or saved to the ini file
+  std::map<INT64, LightingValues> presets{};
+
+  // The ini file is read once during initialization and the ini structure is kept as the image of the file.
+  // Saving a preset updates the image and writes it to the file, loading a preset never reads the file again.
   mINI::INIStructure ini;
   mINI::INIFile iniFile;
-  // Flag to indicate if the ini file should be read - only read it when loading a new preset
-  // but don't read it again during the loading process of one preset
-  // This way we avoid reading the ini file multiple times when loading a single preset but still read it
-  // when loading a new preset which allows to manually change the ini file while the sim is running
-  // for testing manually configured presets.
-  bool readIniFile = true;
 
   LightingPresets(MsfsHandler& handler) : Module(handler), iniFile(CONFIGURATION_FILEPATH) {}
 
@@ -58,10 +95,26 @@ class LightingPresets : public Module {
 
   /**
    * Initializes the aircraft specific variables.
+   * The aircraft needs to define its lighting variables with addLightingVariable().
    * @return true if successful, false otherwise.
    */
   virtual bool initialize_aircraft() = 0; // this needs to be implemented by the derived class (aircraft)
 
+  /**
+   * Adds a variable to the layout of the lighting values.
+   * @param variable the variable in the aircraft
+   * @param iniKey the key of the value in the ini file
+   * @param defaultValue the normalized value used if a preset does not contain the variable
+   * @param scale factor to convert the value of the variable to the normalized range 0..100 (default 1.0)
+   * @param interpolate if false the preset value is applied directly instead of being interpolated (default true)
+   * @return the index of the variable in the lighting values
+   */
+  std::size_t addLightingVariable(const CacheableVariablePtr& variable,
+                                  const std::string& iniKey,
+                                  FLOAT64 defaultValue = 50.0,
+                                  FLOAT64 scale = 1.0,
+                                  bool interpolate = true);
+
   /**
    * Loads a specified preset
    * @param loadPresetRequest the number of the preset to be loaded
@@ -77,48 +130,37 @@ class LightingPresets : public Module {
   void saveLightingPreset(INT64 savePresetRequest);
 
   /**
-   * Read the current lighting level from the aircraft.
-   * The values need to be normalized to the range 0 too 100.
+   * Reads the current lighting values of all lighting variables from the aircraft in one pass.
+   * The values are normalized to the range 0 to 100.
    */
-  virtual void readFromAircraft() = 0;
+  void readFromAircraft();
 
   /**
-   * Applies the currently loaded preset to the aircraft.
-   * The normalized values (0..100) need to be converted back to the range the
-   * light variable in the aircraft expects.
+   * Applies the intermediate lighting values to all lighting variables of the aircraft in one pass.
+   * Only variables whose value has changed are written to the sim.
+   * Aircraft can override this to apply additional aircraft specific logic.
    */
-  virtual void applyToAircraft() = 0;
+  virtual void applyToAircraft();
 
   /**
-   * Reads a stored preset from the persistence store.
-   * @return true if successful, false otherwise.
+   * Returns the lighting values of a preset.
+   * The values are read from the ini image the first time a preset is requested and kept in memory.
+   * @param presetNr the number of the preset
+   * @return the lighting values of the preset - the default values if the preset does not exist
    */
-  bool readFromStore(INT64 presetNr);
+  const LightingValues& getPreset(INT64 presetNr);
 
   /**
-   * Loads the current values from the provided ini structure.
+   * Stores the current values as a preset in memory and in the persistent store.
    * @return true if successful, false otherwise.
    */
-  virtual void loadFromIni(const mINI::INIStructure& ini, const std::string& iniSectionName) = 0;
+  bool saveToStore(INT64 presetNr);
 
   /**
-   * Stores the current values into the persistent store.
-   * @return true if successful, false otherwise.
-   */
-  virtual bool saveToStore(INT64 presetNr);
-
-  /**
-   * Saves the current values to the provided ini structure.
-   * @param ini
-   * @param iniSectionName
-   */
-  virtual void saveToIni(mINI::INIStructure& ini, const std::string& iniSectionName) const = 0;
-
-  /**
-   * Calculates the intermediate values between the current values and the preset values.
-   * @return true if the intermediate values are equal to the current values.
+   * Produces a string with the lighting variables and their intermediate values.
+   * @return string with the lighting variables and their intermediate values.
    */
-  virtual bool calculateIntermediateValues(FLOAT64 stepSize) = 0;
+  [[maybe_unused]] [[nodiscard]] std::string str() const;
 
   /**
    * Get the variable for the potentiometer of a specific light
@@ -138,14 +180,6 @@ class LightingPresets : public Module {
    * @return the value of the key or the default value if the key does not exist
    */
   static FLOAT64 iniGetOrDefault(const mINI::INIStructure& ini, const std::string& section, const std::string& key, FLOAT64 defaultValue);
-
-  /**
-   * Converges a momentary value towards a target value.
-   * @param momentary the momentary value
-   * @param target the target value
-   * @return the converged value
-   */
-  FLOAT64 convergeValue(FLOAT64 momentary, FLOAT64 target, FLOAT64 stepSize);
 };
 
 #endif  // FLYBYWIRE_AIRCRAFT_LIGHTINGPRESETS_H
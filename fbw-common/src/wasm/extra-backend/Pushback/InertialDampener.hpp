@@ -46,4 +46,10 @@ class InertialDampener {
     lastValue += (newTargetValue > lastValue ? accelStepSize : -accelStepSize);
     return lastValue;
   }
+
+  /**
+   * Sets the internal state value, e.g. to restart from standstill.
+   * @param value the new internal state value
+   */
+  void reset(double value) { lastValue = value; }
 };
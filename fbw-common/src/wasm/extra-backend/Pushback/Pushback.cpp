@@ -21,8 +21,11 @@
 //
 // It also uses DataDefinition to read and write multiple variables at once.
 //
-// The PushbackBaseInfo struct is used to read multiple variables at once every visual frame using
-// the periodic data request feature of the DataDefinition.
+// The PushbackBaseInfo struct is used to read multiple variables at once using the periodic data
+// request feature of the DataDefinition. The sim only sends the data when it has changed and a
+// callback updates the pushback state, so no polling is required while the pushback is inactive.
+// The PushbackAircraftData struct changes nearly every frame and is therefore only requested every
+// visual frame while a pushback is active.
 //
 // The rest are read on demand after the state of the above variables have been checked.
 // No variable is written automatically.
@@ -34,10 +37,6 @@
 bool Pushback::initialize() {
   dataManager = &msfsHandler.getDataManager();
 
-  // LVARs - will be updated every tick if the pushback system is enabled and the tug connected
-  tugCommandedSpeedFactor = dataManager->make_named_var("PUSHBACK_SPD_FACTOR");
-  tugCommandedHeadingFactor = dataManager->make_named_var("PUSHBACK_HDG_FACTOR");
-
   // Aircraft configuration
   //  update frequency can be lower as this is only used for tuning and therefore not critical
   //  (e.g. 0.5 Hz or every 30 ticks is enough)
@@ -49,14 +48,29 @@ bool Pushback::initialize() {
   aircraftTurnSpeedFactor->setAndWriteToSim(this->getTurnSpeedFactor());
 
   // Pushback Base Data
-  //  will be updated every visual frame
+  //  will be updated every visual frame in which any of the values has changed
   DataDefinitionVector pushbackBaseDataDef = {{"L:A32NX_PUSHBACK_SYSTEM_ENABLED", 0, UNITS.Bool},
                                        {"L:A32NX_PARK_BRAKE_LEVER_POS", 0, UNITS.Bool},
                                        {"PUSHBACK ATTACHED", 0, UNITS.Bool},
-                                       {"PLANE HEADING DEGREES TRUE", 0, UNITS.degrees},
-                                       {"RELATIVE WIND VELOCITY BODY Z", 0, UNITS.FeetSec}};
+                                       {"L:A32NX_PUSHBACK_SPD_FACTOR", 0, UNITS.Number},
+                                       {"L:A32NX_PUSHBACK_HDG_FACTOR", 0, UNITS.Number}};
   pushbackBaseInfoPtr = dataManager->make_datadefinition_var<PushbackBaseInfo>("PUSHBACK BASE DATA", pushbackBaseDataDef);
-  pushbackBaseInfoPtr->requestPeriodicDataFromSim(SIMCONNECT_PERIOD_VISUAL_FRAME);
+  pushbackBaseInfoCallbackId = pushbackBaseInfoPtr->addCallback([&]() {
+    const bool active = pushbackBaseInfoPtr->data().pushbackSystemEnabled && pushbackBaseInfoPtr->data().pushbackAttached;
+    if (active != pushbackActive) {
+      pushbackAircraftDataPtr->requestPeriodicDataFromSim(active ? SIMCONNECT_PERIOD_VISUAL_FRAME : SIMCONNECT_PERIOD_NEVER);
+      pushbackAircraftDataRequestTick = msfsHandler.getTickCounter();
+    }
+    pushbackActive = active;
+  });
+  pushbackBaseInfoPtr->requestPeriodicDataFromSim(SIMCONNECT_PERIOD_VISUAL_FRAME, SIMCONNECT_DATA_REQUEST_FLAG_CHANGED);
+
+  // Pushback Aircraft Data
+  //  will be updated every visual frame while a pushback is active - requested by the callback above
+  //  the change check is skipped so the tick stamp shows when the data was last received
+  DataDefinitionVector pushbackAircraftDataDef = {{"PLANE HEADING DEGREES TRUE", 0, UNITS.degrees}};
+  pushbackAircraftDataPtr = dataManager->make_datadefinition_var<PushbackAircraftData>("PUSHBACK AIRCRAFT DATA", pushbackAircraftDataDef);
+  pushbackAircraftDataPtr->setSkipChangeCheck(true);
 
   // Data definitions for PushbackDataID
   //  Will only be written to sim if the pushback system is enabled and the tug connected
@@ -98,15 +112,22 @@ bool Pushback::preUpdate([[maybe_unused]] sGaugeDrawData* pData) {
   return true;
 }
 
-bool Pushback::update(sGaugeDrawData* pData) {
+bool Pushback::update([[maybe_unused]] sGaugeDrawData* pData) {
   if (!_isInitialized) {
     std::cerr << "Pushback::update() - not initialized" << std::endl;
     return false;
   }
 
   // Check if the pushback system is enabled and conditions are met
-  if (!msfsHandler.getAircraftIsReadyVar() || !pushbackBaseInfoPtr->data().pushbackSystemEnabled ||
-      !pushbackBaseInfoPtr->data().pushbackAttached || !msfsHandler.getSimOnGround()) {
+  // Otherwise the integration is reset, so the next pushback starts from a standing tug
+  if (!msfsHandler.getAircraftIsReadyVar() || !pushbackActive || !msfsHandler.getSimOnGround()) {
+    integrator.reset();
+    return true;
+  }
+
+  // The aircraft data is requested when the pushback becomes active and arrives with one of the
+  // next frames - until then the tug heading would be based on an outdated aircraft heading
+  if (pushbackAircraftDataPtr->getTickStamp() <= pushbackAircraftDataRequestTick) {
     return true;
   }
 
@@ -115,33 +136,36 @@ bool Pushback::update(sGaugeDrawData* pData) {
   const FLOAT64 timeStamp = msfsHandler.getTimeStamp();
   const UINT64 tickCounter = msfsHandler.getTickCounter();
 
-  // pushbackBaseInfoPtr is updated at every tick, so we can simply use it here
-  const bool parkingBrakeEngaged = static_cast<bool>(pushbackBaseInfoPtr->data().parkingBrakeEngaged);
+  // pushbackBaseInfoPtr always holds the latest values sent by the sim, so we can simply use it here
+  const PushbackBaseInfo& baseInfo = pushbackBaseInfoPtr->data();
+  const bool parkingBrakeEngaged = static_cast<bool>(baseInfo.parkingBrakeEngaged);
 
   // read all data from sim - could be done inline but better readability this way
-  tugCommandedSpeedFactor->updateFromSim(timeStamp, tickCounter);
-  tugCommandedHeadingFactor->updateFromSim(timeStamp, tickCounter);
   aircraftParkingBrakeFactor->updateFromSim(timeStamp, tickCounter);
   aircraftSpeedFactor->updateFromSim(timeStamp, tickCounter);
   aircraftTurnSpeedFactor->updateFromSim(timeStamp, tickCounter);
 
   // Based on an aircraft specific speed factor and the user input (0.0-1.0),
-  // the inertia speed (current actual speed) is calculated in ft/sec.
+  // the commanded speed is calculated in ft/sec.
   const double speedFactor =
       parkingBrakeEngaged ? (aircraftSpeedFactor->get() / aircraftParkingBrakeFactor->get()) : aircraftSpeedFactor->get();
-  const FLOAT64 tugCmdSpd = tugCommandedSpeedFactor->get() * speedFactor;
-  const FLOAT64 inertiaSpeed = speedDampener.updateSpeed(tugCmdSpd);
+  const FLOAT64 tugCmdSpd = baseInfo.tugCommandedSpeedFactor * speedFactor;
 
   // Based on an aircraft-specific turn speed factor and the user input (0.0-1.0),
-  // the rotation velocity is calculated in ft/sec.
+  // the rotation velocity per speed is calculated.
   const double turnSpeedHdgFactor =
       parkingBrakeEngaged ? (aircraftTurnSpeedFactor->get() / aircraftParkingBrakeFactor->get()) : aircraftTurnSpeedFactor->get();
-  const FLOAT64 computedRotationVelocity = turnDampener.updateSpeed(
-      (inertiaSpeed / aircraftSpeedFactor->get()) * tugCommandedHeadingFactor->get() * turnSpeedHdgFactor);
+  const FLOAT64 rotationPerSpeed = baseInfo.tugCommandedHeadingFactor * turnSpeedHdgFactor / aircraftSpeedFactor->get();
+
+  // The inertia speed (current actual speed) and the rotation velocity are integrated over the
+  // elapsed simulation time, so they follow the simulation rate and not the frame rate.
+  const PushbackState state = integrator.update(msfsHandler.getSimulationDeltaTime(), tugCmdSpd, rotationPerSpeed);
+  const FLOAT64 inertiaSpeed = state.speed;
+  const FLOAT64 computedRotationVelocity = state.rotationVelocity;
 
   // The heading of the tug is calculated based on the aircraft heading and the user input (0.0-1.0).
   const FLOAT64 computedTugHdg =
-      helper::Math::angleAdd(pushbackBaseInfoPtr->data().aircraftHeading, tugCommandedHeadingFactor->get() * -90);
+      helper::Math::angleAdd(pushbackAircraftDataPtr->data().aircraftHeading, baseInfo.tugCommandedHeadingFactor * -90);
   // K:KEY_TUG_HEADING expects an unsigned integer scaling 360° to 0 to 2^32-1 (0xffffffff / 360)
   // https://docs.flightsimulator.com/html/Programming_Tools/Event_IDs/Aircraft_Misc_Events.htm#TUG_HEADING
   const uint32_t convertedComputedTugHeading = static_cast<uint32_t>(computedTugHdg * (UINT32_MAX / 360));
@@ -178,7 +202,7 @@ bool Pushback::update(sGaugeDrawData* pData) {
 
   // send as LVARs for debugging in the flyPad
   if (pushbackDebug->getAsBool()) {
-    pushbackDebugPtr->data().updateDelta = pData->dt;
+    pushbackDebugPtr->data().updateDelta = msfsHandler.getSimulationDeltaTime();
     pushbackDebugPtr->data().tugCommandedSpeed = tugCmdSpd;
     pushbackDebugPtr->data().tugCommandedHeading = computedTugHdg;
     pushbackDebugPtr->data().tugInertiaSpeed = inertiaSpeed;
@@ -198,6 +222,7 @@ bool Pushback::postUpdate([[maybe_unused]] sGaugeDrawData* pData) {
 }
 
 bool Pushback::shutdown() {
+  pushbackBaseInfoPtr->removeCallback(pushbackBaseInfoCallbackId);
   _isInitialized = false;
   LOG_INFO("Pushback::shutdown()");
   return true;
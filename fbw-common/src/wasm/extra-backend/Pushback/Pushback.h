@@ -6,7 +6,7 @@
 
 #include "DataManager.h"
 #include "Module.h"
-#include "Pushback/InertialDampener.hpp"
+#include "Pushback/PushbackIntegrator.hpp"
 
 #ifdef __cpp_lib_math_constants
 #include <numbers>
@@ -29,6 +29,11 @@ using DataDefinitionVector = std::vector<DataDefinition>;
  *
  * - Pushback Attached (simvar)
  * - SIM ON GROUND (simvar)
+ *
+ * These are received from the sim only when they change. The aircraft heading is only received
+ * while a pushback is active. The tug movement is only computed while a pushback is active and is
+ * integrated in fixed time steps by the PushbackIntegrator, so it does not depend on the frame rate
+ * or the simulation rate.
  */
 class Pushback : public Module {
  private:
@@ -37,23 +42,33 @@ class Pushback : public Module {
   // Convenience pointer to the data manager
   DataManager* dataManager = nullptr;
 
-  // Used to smoothen acceleration and deceleration
-  InertialDampener speedDampener{0.0, 0.15, 0.1};
-  InertialDampener turnDampener{0.0, 0.01, 0.001};
-
-  // LVARs
-  NamedVariablePtr tugCommandedSpeedFactor;
-  NamedVariablePtr tugCommandedHeadingFactor;
+  // Integrates the tug movement in fixed time steps
+  PushbackIntegrator integrator{};
 
   // Base data structure for PushbackBaseInfo
+  // Includes the user input so all inputs are received from the sim when they change
   struct PushbackBaseInfo {
     FLOAT64 pushbackSystemEnabled;
     FLOAT64 parkingBrakeEngaged;
     FLOAT64 pushbackAttached;
-    FLOAT64 aircraftHeading;
-    FLOAT64 windVelBodyZ;
+    FLOAT64 tugCommandedSpeedFactor;
+    FLOAT64 tugCommandedHeadingFactor;
   };
   DataDefinitionVariablePtr<PushbackBaseInfo> pushbackBaseInfoPtr;
+  CallbackID pushbackBaseInfoCallbackId{};
+
+  // true if the pushback system is enabled and the tug attached - updated when PushbackBaseInfo changes
+  bool pushbackActive = false;
+
+  // Data structure for PushbackAircraftData
+  // Changes nearly every frame, so it is only requested from the sim while a pushback is active
+  struct PushbackAircraftData {
+    FLOAT64 aircraftHeading;
+  };
+  DataDefinitionVariablePtr<PushbackAircraftData> pushbackAircraftDataPtr;
+
+  // tick in which the PushbackAircraftData was requested - older data is not used
+  UINT64 pushbackAircraftDataRequestTick = 0;
 
   // Data structure for PushbackDataID
   struct PushbackData {
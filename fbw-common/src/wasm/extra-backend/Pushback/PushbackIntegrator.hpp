@@ -0,0 +1,85 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include "InertialDampener.hpp"
+
+/**
+ * The state of the tug movement computed by the PushbackIntegrator.
+ */
+struct PushbackState {
+  double speed{};             // ft/sec for "VELOCITY BODY Z"
+  double rotationVelocity{};  // ft/sec for "ROTATION VELOCITY BODY Y"
+};
+
+/**
+ * The PushbackIntegrator advances the tug movement in fixed time steps independent of the frame
+ * rate and the simulation rate.
+ *
+ * The elapsed simulation time is accumulated and the dampened speed and rotation velocity are
+ * advanced by as many fixed steps as fit into the accumulated time. The remaining time is used to
+ * interpolate between the last two steps, so the output is smooth even if the frame rate is not a
+ * multiple of the step rate. This delays the output by one fixed step. Given the same inputs per
+ * unit of simulation time the resulting trajectory is therefore the same at any frame rate.
+ *
+ * At most MAX_STEPS_PER_UPDATE steps are run per update. Simulation time beyond that is dropped,
+ * which only happens after a stall or at very high simulation rates and low frame rates.
+ */
+class PushbackIntegrator {
+ public:
+  // the fixed time step of the integration in seconds
+  static constexpr double FIXED_TIME_STEP = 1.0 / 60.0;
+  // upper limit of steps per update to avoid catching up with a long time after a stall
+  // 2 seconds of simulation time, e.g. a simulation rate of 32 at 16 frames per second
+  static constexpr int MAX_STEPS_PER_UPDATE = 120;
+
+ private:
+  // Used to smoothen acceleration and deceleration - the step sizes are per fixed time step
+  InertialDampener speedDampener{0.0, 0.15, 0.1};
+  InertialDampener turnDampener{0.0, 0.01, 0.001};
+
+  PushbackState previousState{};
+  PushbackState currentState{};
+  double accumulatedTime{};
+
+ public:
+  /**
+   * Advances the integration by the given simulation time.
+   * @param deltaTime the elapsed simulation time in seconds
+   * @param targetSpeed the commanded speed of the tug in ft/sec
+   * @param rotationPerSpeed the commanded rotation velocity per unit of speed
+   * @return the state interpolated between the last two fixed steps by the remaining time, i.e. the
+   *         state one fixed step before the end of the elapsed time
+   */
+  PushbackState update(double deltaTime, double targetSpeed, double rotationPerSpeed) {
+    accumulatedTime += deltaTime;
+    int steps = 0;
+    while (accumulatedTime >= FIXED_TIME_STEP && steps < MAX_STEPS_PER_UPDATE) {
+      previousState = currentState;
+      currentState.speed = speedDampener.updateSpeed(targetSpeed);
+      currentState.rotationVelocity = turnDampener.updateSpeed(currentState.speed * rotationPerSpeed);
+      accumulatedTime -= FIXED_TIME_STEP;
+      steps++;
+    }
+    // drop the time which could not be caught up with
+    if (accumulatedTime >= FIXED_TIME_STEP) {
+      accumulatedTime = 0.0;
+    }
+
+    const double alpha = accumulatedTime / FIXED_TIME_STEP;
+    return {previousState.speed + (currentState.speed - previousState.speed) * alpha,
+            previousState.rotationVelocity + (currentState.rotationVelocity - previousState.rotationVelocity) * alpha};
+  }
+
+  /**
+   * Resets the integration to a standing tug.
+   */
+  void reset() {
+    speedDampener.reset(0.0);
+    turnDampener.reset(0.0);
+    previousState = {};
+    currentState = {};
+    accumulatedTime = 0.0;
+  }
+};
@@ -4,7 +4,7 @@
 #ifndef FLYBYWIRE_AIRCRAFT_ENGINERATIOS_HPP
 #define FLYBYWIRE_AIRCRAFT_ENGINERATIOS_HPP
 
-#include <MSFS/Legacy/gauges.h>
+#include <cmath>
 
 /**
  * @class EngineRatios
@@ -23,7 +23,7 @@ class EngineRatios {
    * @param ambientTemp The ambient temperature in degrees Celsius.
    * @return The ratio of the ambient temperature to the standard temperature at sea level in degrees Celsius.
    */
-  static FLOAT64 theta(double ambientTemp) {
+  static double theta(double ambientTemp) {
     return (273.15 + ambientTemp) / 288.15;
   }
 
@@ -37,7 +37,7 @@ class EngineRatios {
    * @param ambientPressure The ambient pressure in hPa.
    * @return The ratio of the ambient pressure to the standard pressure at sea level in hPa.
    */
-  static FLOAT64 delta(double ambientPressure) {
+  static double delta(double ambientPressure) {
     return ambientPressure / 1013.0;
   }
 
@@ -55,7 +55,7 @@ class EngineRatios {
    * @return The ratio of the total temperature to the standard temperature at sea level, accounting
    *         for the effects of Mach number.
    */
-  static FLOAT64 theta2(double mach, double ambientTemp) {
+  static double theta2(double mach, double ambientTemp) {
     return theta(ambientTemp) * (1 + 0.2 * (std::pow)(mach, 2));
   }
 
@@ -71,7 +71,7 @@ class EngineRatios {
    * @param ambientPressure The ambient pressure in hPa.
    * @return The ratio of the total pressure to the standard pressure at sea level, accounting for the effects of Mach number.
    */
-  static FLOAT64 delta2(double mach, double ambientPressure) {
+  static double delta2(double mach, double ambientPressure) {
     return delta(ambientPressure) * (std::pow)((1 + 0.2 * (std::pow)(mach, 2)), 3.5);
   }
 };
@@ -0,0 +1,62 @@
+// Copyright (c) 2023-2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_FADECMATH_HPP
+#define FLYBYWIRE_AIRCRAFT_FADECMATH_HPP
+
+#include <cmath>
+
+/**
+ * @class FadecMath
+ * @brief Helper functions used by the engine model tables and the engine control.
+ *
+ * This header only depends on the standard library, so the engine model (polynomials, tables and thrust limits) can
+ * also be compiled and exercised outside of the simulator.
+ */
+class FadecMath {
+ public:
+  /**
+   * @brief Interpolates a value using linear interpolation.
+   *
+   * This function performs linear interpolation based on the input parameters. It calculates the value of 'y' at a given 'x'
+   * using the formula for linear interpolation: y = ((y0 * (x1 - x)) + (y1 * (x - x0))) / (x1 - x0).
+   * If x0 is equal to x1, it returns y0 to avoid division by zero.
+   *
+   * This function is used by MSFS for the engine tables.
+   *
+   * @param x The 'x' value at which to interpolate.
+   * @param x0 The 'x' value of the first data point.
+   * @param x1 The 'x' value of the second data point.
+   * @param y0 The 'y' value of the first data point.
+   * @param y1 The 'y' value of the second data point.
+   * @return The interpolated 'y' value at 'x'.
+   */
+  static double interpolate(double x, double x0, double x1, double y0, double y1) {
+    if (x0 == x1)
+      return y0;
+    if (x < x0)
+      return y0;
+    if (x > x1)
+      return y1;
+    return ((y0 * (x1 - x)) + (y1 * (x - x0))) / (x1 - x0);
+  }
+
+  /**
+   * @brief Converts calibrated airspeed (CAS) to Mach number.
+   *
+   * This function converts the calibrated airspeed (CAS) to the Mach number. The conversion is based on the ambient pressure and a constant
+   * `k`. The Mach number is calculated using the formula: sqrt((5 * pow(((pow(((pow(cas, 2) / k) + 1), 3.5) * (1 / delta)) - (1 / delta) +
+   * 1), 0.285714286)) - 5), where delta is the ratio of the ambient pressure to the standard pressure at sea level.
+   *
+   * @param cas The calibrated airspeed in knots.
+   * @param ambientPressure The ambient pressure in hPa.
+   * @return The Mach number.
+   */
+  static double cas2mach(double cas, double ambientPressure) {
+    double k = 2188648.141;
+    double delta = ambientPressure / 1013;
+    return sqrt((5 * (std::pow)((((std::pow)((((std::pow)(cas, 2) / k) + 1), 3.5) * (1 / delta)) - (1 / delta) + 1), 0.285714286)) - 5);
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_FADECMATH_HPP
@@ -0,0 +1,127 @@
+// Copyright (c) 2023-2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_GRIDLOOKUPTABLE_HPP
+#define FLYBYWIRE_AIRCRAFT_GRIDLOOKUPTABLE_HPP
+
+#include <array>
+#include <cstddef>
+
+/**
+ * @class GridLookupTable
+ * @brief Compile-time lookup table with linear interpolation between rows.
+ *
+ * The first column of the table holds the breakpoints in ascending order, the other columns the values at these
+ * breakpoints. The breakpoint range is resampled into `Cells` uniform cells which store the segment their start falls
+ * into, so a lookup indexes its cell directly and only steps over the breakpoints inside that cell instead of scanning
+ * the table from the first row. The slopes of all segments are precomputed.
+ *
+ * Like FadecMath::interpolate, values are held constant outside of the breakpoints.
+ *
+ * @tparam Rows The number of rows (breakpoints) of the table.
+ * @tparam Columns The number of columns including the breakpoint column.
+ * @tparam Cells The number of uniform cells used to find the segment of a breakpoint value.
+ */
+template <std::size_t Rows, std::size_t Columns, std::size_t Cells = 64>
+class GridLookupTable {
+  static_assert(Rows >= 2, "a lookup table needs at least two rows");
+  static_assert(Columns >= 2, "a lookup table needs at least one value column");
+  static_assert(Cells >= 1, "a lookup table needs at least one cell");
+
+ public:
+  /**
+   * @brief Builds the lookup table from consecutive rows of a larger table.
+   *
+   * @param table The table containing the breakpoints in its first column.
+   * @param firstRow The first row of `table` to use, `Rows` rows are used from there.
+   */
+  template <std::size_t TableRows>
+  constexpr explicit GridLookupTable(const double (&table)[TableRows][Columns], std::size_t firstRow = 0) {
+    for (std::size_t row = 0; row < Rows; row++) {
+      for (std::size_t column = 0; column < Columns; column++) {
+        values[row][column] = table[firstRow + row][column];
+      }
+    }
+
+    for (std::size_t row = 0; row < Rows - 1; row++) {
+      const double span = values[row + 1][0] - values[row][0];
+      for (std::size_t column = 1; column < Columns; column++) {
+        slopes[row][column] = span != 0 ? (values[row + 1][column] - values[row][column]) / span : 0;
+      }
+    }
+
+    const double first = values[0][0];
+    const double last = values[Rows - 1][0];
+    cellsPerUnit = last > first ? Cells / (last - first) : 0;
+
+    std::size_t segment = 0;
+    for (std::size_t cell = 0; cell < Cells; cell++) {
+      const double cellStart = first + cell * ((last - first) / Cells);
+      while (segment < Rows - 2 && values[segment + 1][0] <= cellStart) {
+        segment++;
+      }
+      cellSegments[cell] = segment;
+    }
+  }
+
+  /**
+   * @brief Finds the segment containing the given breakpoint value.
+   *
+   * @param x The breakpoint value.
+   * @return The index i of the segment with breakpoint[i] <= x < breakpoint[i + 1], clamped to the first and last segment.
+   */
+  [[nodiscard]] constexpr std::size_t segment(double x) const {
+    if (!(x > values[0][0])) {
+      return 0;
+    }
+    if (x >= values[Rows - 1][0]) {
+      return Rows - 2;
+    }
+
+    std::size_t cell = static_cast<std::size_t>((x - values[0][0]) * cellsPerUnit);
+    std::size_t index = cellSegments[cell < Cells ? cell : Cells - 1];
+    // the cell start is rounded, so the value may lie just before the segment stored for the cell
+    while (index > 0 && values[index][0] > x) {
+      index--;
+    }
+    while (index < Rows - 2 && values[index + 1][0] <= x) {
+      index++;
+    }
+    return index;
+  }
+
+  /**
+   * @brief Interpolates all columns of the table at the given breakpoint value.
+   *
+   * @param x The breakpoint value.
+   * @return The interpolated row, the first element being the breakpoint value clamped to the table.
+   */
+  [[nodiscard]] constexpr std::array<double, Columns> row(double x) const {
+    std::array<double, Columns> result = {};
+    if (x >= values[Rows - 1][0]) {
+      for (std::size_t column = 0; column < Columns; column++) {
+        result[column] = values[Rows - 1][column];
+      }
+      return result;
+    }
+
+    const std::size_t index = segment(x);
+    const double lower = values[index][0];
+    const double upper = values[index + 1][0];
+    const double clamped = x < lower ? lower : (x > upper ? upper : x);
+
+    result[0] = clamped;
+    for (std::size_t column = 1; column < Columns; column++) {
+      result[column] = values[index][column] + slopes[index][column] * (clamped - lower);
+    }
+    return result;
+  }
+
+ private:
+  double values[Rows][Columns] = {};
+  double slopes[Rows - 1][Columns] = {};
+  std::size_t cellSegments[Cells] = {};
+  double cellsPerUnit = 0;
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_GRIDLOOKUPTABLE_HPP
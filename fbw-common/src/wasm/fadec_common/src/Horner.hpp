@@ -0,0 +1,36 @@
+// Copyright (c) 2023-2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_HORNER_HPP
+#define FLYBYWIRE_AIRCRAFT_HORNER_HPP
+
+#include <cstddef>
+
+/**
+ * @class Horner
+ * @brief Evaluation of single-variable polynomials in Horner form.
+ *
+ * The engine model polynomials have up to 16 terms. Summing coefficients[i] * pow(x, i) costs one pow call per
+ * term, Horner's scheme needs one multiplication and one addition per term instead and is numerically at least as
+ * accurate.
+ */
+class Horner {
+ public:
+  /**
+   * @brief Evaluates the polynomial sum(coefficients[i] * x^i).
+   *
+   * @param coefficients The coefficients in ascending order of the power of x.
+   * @param x The value to evaluate the polynomial at.
+   * @return The value of the polynomial.
+   */
+  template <std::size_t N>
+  static constexpr double evaluate(const double (&coefficients)[N], double x) {
+    double result = coefficients[N - 1];
+    for (std::size_t i = N - 1; i > 0; i--) {
+      result = result * x + coefficients[i - 1];
+    }
+    return result;
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_HORNER_HPP
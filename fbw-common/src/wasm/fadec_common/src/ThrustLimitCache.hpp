@@ -0,0 +1,162 @@
+// Copyright (c) 2023-2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_THRUSTLIMITCACHE_HPP
+#define FLYBYWIRE_AIRCRAFT_THRUSTLIMITCACHE_HPP
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @class ThrustLimitCache
+ * @brief Memoizes the N1 thrust limits of an aircraft's ThrustLimits class between frames.
+ *
+ * The pressure altitude and the ambient temperature are quantized into bands. The limits without the bleed correction
+ * are only evaluated at the four corners of the current altitude/temperature band and interpolated bilinearly in
+ * between, so they are recomputed when the aircraft leaves the band or the flex temperature changes.
+ *
+ * The bleed correction steps at 8000 ft and at the corner and limit points, so it is not interpolated but added at the
+ * current conditions. For the same reason the CLB limit is evaluated directly in the band containing the CLB speed
+ * change.
+ *
+ * The ambient pressure used for the CLB and MCT Mach number is derived from the altitude with the standard atmosphere,
+ * which is what the pressure altitude is based on.
+ *
+ * @tparam ThrustLimits The aircraft's thrust limits class providing static limitRow(), limitN1WithoutBleed() and
+ * bleedTotal() functions and the CLIMB_SPEED_CHANGE_ALTITUDE.
+ */
+template <class ThrustLimits>
+class ThrustLimitCache {
+ public:
+  /**
+   * @brief The N1 limits before the TO/GA blending and the CLB/MCT transitions of the engine control.
+   */
+  struct Limits {
+    double to;
+    double ga;
+    double flexTo;
+    double flexGa;
+    double clb;
+    double mct;
+  };
+
+  static constexpr double ALTITUDE_BAND = 100.0;         // feet
+  static constexpr double TEMPERATURE_BAND = 1.0;        // degrees Celsius
+  static constexpr double TAKEOFF_MAX_ALTITUDE = 16600;  // feet, upper end of the TO and GA tables
+
+  /**
+   * @brief Returns the N1 limits for the given conditions, recomputing the corners only if the band or flex changed.
+   *
+   * @param pressureAltitude The pressure altitude in feet.
+   * @param ambientTemperature The ambient temperature in degrees Celsius.
+   * @param flexTemp The flex temperature in degrees Celsius, 0 if no flex temperature is set.
+   * @param packs The status of the air conditioning (0 for off, 1 for on).
+   * @param nacelle The status of the nacelle anti-ice (0 for off, 1 for on).
+   * @param wing The status of the wing anti-ice (0 for off, 1 for on).
+   * @return The interpolated N1 limits.
+   */
+  Limits get(double pressureAltitude, double ambientTemperature, double flexTemp, int packs, int nacelle, int wing) {
+    const double altitudePosition = pressureAltitude / ALTITUDE_BAND;
+    const double temperaturePosition = ambientTemperature / TEMPERATURE_BAND;
+    const Key currentKey{std::floor(altitudePosition), std::floor(temperaturePosition), flexTemp};
+
+    if (!valid || !(currentKey == key)) {
+      key = currentKey;
+      valid = true;
+      for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 2; j++) {
+          corners[i][j] = compute((key.altitudeBand + i) * ALTITUDE_BAND, (key.temperatureBand + j) * TEMPERATURE_BAND, flexTemp);
+        }
+      }
+    }
+
+    const double altitudeFraction = altitudePosition - key.altitudeBand;
+    const double temperatureFraction = temperaturePosition - key.temperatureBand;
+    Limits limits = interpolate(interpolate(corners[0][0], corners[0][1], temperatureFraction),
+                                interpolate(corners[1][0], corners[1][1], temperatureFraction), altitudeFraction);
+
+    const double bandStart = key.altitudeBand * ALTITUDE_BAND;
+    if (bandStart <= ThrustLimits::CLIMB_SPEED_CHANGE_ALTITUDE && ThrustLimits::CLIMB_SPEED_CHANGE_ALTITUDE < bandStart + ALTITUDE_BAND) {
+      limits.clb = ThrustLimits::limitN1WithoutBleed(2, ThrustLimits::limitRow(2, pressureAltitude), pressureAltitude, ambientTemperature,
+                                                     standardPressure(pressureAltitude), 0);
+    }
+
+    if (packs != 0 || nacelle != 0 || wing != 0) {
+      const double takeoffAltitude = (std::min)(TAKEOFF_MAX_ALTITUDE, pressureAltitude);
+      limits.to += bleed(0, takeoffAltitude, ambientTemperature, 0, packs, nacelle, wing);
+      limits.ga += bleed(1, takeoffAltitude, ambientTemperature, 0, packs, nacelle, wing);
+      if (flexTemp > 0) {
+        limits.flexTo += bleed(0, takeoffAltitude, ambientTemperature, flexTemp, packs, nacelle, wing);
+        limits.flexGa += bleed(1, takeoffAltitude, ambientTemperature, flexTemp, packs, nacelle, wing);
+      }
+      limits.clb += bleed(2, pressureAltitude, ambientTemperature, 0, packs, nacelle, wing);
+      limits.mct += bleed(3, pressureAltitude, ambientTemperature, 0, packs, nacelle, wing);
+    }
+    return limits;
+  }
+
+  /**
+   * @brief Forces the limits to be recomputed with the next call to get().
+   */
+  void invalidate() { valid = false; }
+
+ private:
+  struct Key {
+    double altitudeBand;
+    double temperatureBand;
+    double flexTemp;
+
+    bool operator==(const Key& other) const = default;
+  };
+
+  Key key{};
+  bool valid = false;
+  Limits corners[2][2]{};
+
+  static Limits compute(double altitude, double temperature, double flexTemp) {
+    const double takeoffAltitude = (std::min)(TAKEOFF_MAX_ALTITUDE, altitude);
+    const double pressure = standardPressure(altitude);
+    const auto takeoffRow = ThrustLimits::limitRow(0, takeoffAltitude);
+    const auto goAroundRow = ThrustLimits::limitRow(1, takeoffAltitude);
+
+    Limits limits{};
+    limits.to = ThrustLimits::limitN1WithoutBleed(0, takeoffRow, takeoffAltitude, temperature, pressure, 0);
+    limits.ga = ThrustLimits::limitN1WithoutBleed(1, goAroundRow, takeoffAltitude, temperature, pressure, 0);
+    if (flexTemp > 0) {
+      limits.flexTo = ThrustLimits::limitN1WithoutBleed(0, takeoffRow, takeoffAltitude, temperature, pressure, flexTemp);
+      limits.flexGa = ThrustLimits::limitN1WithoutBleed(1, goAroundRow, takeoffAltitude, temperature, pressure, flexTemp);
+    }
+    limits.clb = ThrustLimits::limitN1WithoutBleed(2, ThrustLimits::limitRow(2, altitude), altitude, temperature, pressure, 0);
+    limits.mct = ThrustLimits::limitN1WithoutBleed(3, ThrustLimits::limitRow(3, altitude), altitude, temperature, pressure, 0);
+    return limits;
+  }
+
+  /**
+   * @brief The bleed correction of the given type of limit at the given conditions.
+   */
+  static double bleed(int type, double altitude, double temperature, double flexTemp, int packs, int nacelle, int wing) {
+    const auto row = ThrustLimits::limitRow(type, altitude);
+    return ThrustLimits::bleedTotal(type, altitude, temperature, row[1], row[2], flexTemp, packs, nacelle, wing);
+  }
+
+  /**
+   * @brief Standard atmosphere pressure in hPa at the given pressure altitude in feet.
+   */
+  static double standardPressure(double altitude) {
+    if (altitude <= 36089) {
+      return 1013.25 * (std::pow)(1 - 6.87559e-6 * altitude, 5.25588);
+    }
+    return 226.321 * (std::exp)(-4.80634e-5 * (altitude - 36089));
+  }
+
+  static Limits interpolate(const Limits& a, const Limits& b, double fraction) {
+    return Limits{a.to + (b.to - a.to) * fraction,              //
+                  a.ga + (b.ga - a.ga) * fraction,              //
+                  a.flexTo + (b.flexTo - a.flexTo) * fraction,  //
+                  a.flexGa + (b.flexGa - a.flexGa) * fraction,  //
+                  a.clb + (b.clb - a.clb) * fraction,           //
+                  a.mct + (b.mct - a.mct) * fraction};
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_THRUSTLIMITCACHE_HPP
@@ -0,0 +1,98 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Conversion of ARINC 429 words between their in-memory representation and the sim variable encoding shared by all
+// aircraft and instruments.
+//
+// In memory a word is 8 bytes: the 32-bit SSM followed by the 32 data bits (float or raw bits). This is the layout of
+// the generated base_arinc_429 struct, the Arinc429Word classes of the aircraft and TerrOnND's types::Arinc429Word.
+// In a sim variable the data bits are stored in the lower and the SSM in the upper 32 bits of an integer held by a
+// double.
+//
+// Converting a word only swaps the two halves of the 64-bit value and converts it to or from a double. Encoding a bus
+// applies this to every word of a bus struct consisting only of words, without branches, in one loop over contiguous
+// memory that the compiler can vectorize.
+namespace Arinc429Codec {
+
+constexpr std::size_t WordSize = 8;
+
+template <typename Word>
+constexpr void checkWord() {
+  static_assert(sizeof(Word) == WordSize, "an ARINC 429 word must consist of a 32-bit SSM and 32 data bits");
+  static_assert(std::is_trivially_copyable_v<Word>, "an ARINC 429 word must be trivially copyable");
+}
+
+// Number of words of a bus struct consisting only of ARINC 429 words.
+template <typename Bus>
+constexpr std::size_t wordCount() {
+  static_assert(sizeof(Bus) % WordSize == 0, "a bus must consist only of ARINC 429 words");
+  static_assert(std::is_trivially_copyable_v<Bus>, "a bus must be trivially copyable");
+  return sizeof(Bus) / WordSize;
+}
+
+// Converts the in-memory bits of a word (SSM in the first 4 bytes) to the sim variable bits and vice versa.
+inline std::uint64_t swapHalves(std::uint64_t bits) {
+  return (bits << 32) | (bits >> 32);
+}
+
+inline double encode(std::uint32_t ssm, std::uint32_t dataBits) {
+  return static_cast<double>(static_cast<std::uint64_t>(ssm) << 32 | dataBits);
+}
+
+inline std::uint32_t ssmFromSimVar(double simVar) {
+  return static_cast<std::uint32_t>(static_cast<std::uint64_t>(simVar) >> 32);
+}
+
+inline std::uint32_t dataBitsFromSimVar(double simVar) {
+  return static_cast<std::uint32_t>(static_cast<std::uint64_t>(simVar) & 0xffffffff);
+}
+
+// Encodes `count` words, which are read from raw memory, into sim variables.
+inline void encodeWords(const void* words, double* simVars, std::size_t count) {
+  const auto* bytes = static_cast<const std::uint8_t*>(words);
+  for (std::size_t i = 0; i < count; i++) {
+    std::uint64_t bits;
+    std::memcpy(&bits, bytes + i * WordSize, WordSize);
+    simVars[i] = static_cast<double>(swapHalves(bits));
+  }
+}
+
+// Decodes `count` sim variables into words, which are written to raw memory.
+inline void decodeWords(const double* simVars, void* words, std::size_t count) {
+  auto* bytes = static_cast<std::uint8_t*>(words);
+  for (std::size_t i = 0; i < count; i++) {
+    const std::uint64_t bits = swapHalves(static_cast<std::uint64_t>(simVars[i]));
+    std::memcpy(bytes + i * WordSize, &bits, WordSize);
+  }
+}
+
+template <typename Word>
+double toSimVar(const Word& word) {
+  checkWord<Word>();
+  double simVar;
+  encodeWords(&word, &simVar, 1);
+  return simVar;
+}
+
+template <typename Word>
+Word fromSimVar(double simVar) {
+  checkWord<Word>();
+  Word word;
+  decodeWords(&simVar, &word, 1);
+  return word;
+}
+
+// Encodes all words of a bus in the order of its members.
+template <typename Bus>
+void encodeBus(const Bus& bus, double (&simVars)[wordCount<Bus>()]) {
+  encodeWords(&bus, simVars, wordCount<Bus>());
+}
+
+}  // namespace Arinc429Codec
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+enum class FirstOrderFilterType : uint8_t { Lag, Washout };
+
+// Bank of first-order lag and washout filters discretised with the bilinear transform, computing the same results as
+// the generated LagFilter and WashoutFilter blocks. The states of all filters are stored contiguously and the
+// coefficients of a filter are only recomputed when its time constant or the sample time changes, so the divisions
+// disappear when the models run at a fixed rate.
+//
+// The bank holds no pointers and can be part of a model's DWork. The generated laws keep their own filter functions,
+// the bank is meant as the target of a post-processing step of the Simulink export.
+template <std::size_t N>
+class FirstOrderFilterBank {
+ public:
+  FirstOrderFilterBank() {
+    // no coefficients are cached yet, NaN never compares equal to a sample time
+    for (std::size_t i = 0; i < N; i++) {
+      sampleTime[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+
+  void reset() {
+    for (std::size_t i = 0; i < N; i++) {
+      initialized[i] = false;
+    }
+  }
+
+  void reset(std::size_t i) { initialized[i] = false; }
+
+  void setCoefficients(std::size_t i, FirstOrderFilterType type, double c1, double dt) {
+    if (dt == sampleTime[i] && c1 == timeConstant[i] && type == types[i]) {
+      return;
+    }
+
+    const double denominator = dt * c1;
+    const double inputGain = type == FirstOrderFilterType::Lag ? denominator / (denominator + 2.0) : 2.0 / (denominator + 2.0);
+    outputGains[i] = (2.0 - denominator) / (denominator + 2.0);
+    inputGains[i] = inputGain;
+    previousInputGains[i] = type == FirstOrderFilterType::Lag ? inputGain : -inputGain;
+    sampleTime[i] = dt;
+    timeConstant[i] = c1;
+    types[i] = type;
+  }
+
+  // Updates a single filter with its current coefficients.
+  double step(std::size_t i, double u) {
+    if (!initialized[i]) {
+      previousInputs[i] = u;
+      previousOutputs[i] = u;
+      initialized[i] = true;
+    }
+
+    const double y = outputGains[i] * previousOutputs[i] + (u * inputGains[i] + previousInputs[i] * previousInputGains[i]);
+    previousOutputs[i] = y;
+    previousInputs[i] = u;
+    return y;
+  }
+
+  double step(std::size_t i, FirstOrderFilterType type, double u, double c1, double dt) {
+    setCoefficients(i, type, c1, dt);
+    return step(i, u);
+  }
+
+  // Updates all filters with their current coefficients in a single pass, for filters whose inputs do not depend on
+  // each other.
+  void update(const double (&u)[N], double (&y)[N]) {
+    for (std::size_t i = 0; i < N; i++) {
+      const double previousInput = initialized[i] ? previousInputs[i] : u[i];
+      const double previousOutput = initialized[i] ? previousOutputs[i] : u[i];
+      y[i] = outputGains[i] * previousOutput + (u[i] * inputGains[i] + previousInput * previousInputGains[i]);
+      previousOutputs[i] = y[i];
+      previousInputs[i] = u[i];
+      initialized[i] = true;
+    }
+  }
+
+ private:
+  double previousInputs[N] = {};
+  double previousOutputs[N] = {};
+  double inputGains[N] = {};
+  double previousInputGains[N] = {};
+  double outputGains[N] = {};
+  double sampleTime[N];
+  double timeConstant[N] = {};
+  FirstOrderFilterType types[N] = {};
+  bool initialized[N] = {};
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+
+// 1-D lookup table with linear interpolation and extrapolation over a fixed number of breakpoints, equivalent to
+// look1_binlxpw. The size is known at compile time and uniform breakpoint spacing is detected once on construction,
+// so uniformly spaced tables find their interval with index arithmetic and small tables with an unrolled scan instead
+// of a binary search. The interval and the interpolation are the same as in look1_binlxpw, so results are identical.
+//
+// The breakpoints and values are copied into the table. A table declared constexpr is therefore built, including the
+// uniform spacing check, at compile time.
+template <size_t N>
+class FixedLookupTable1D {
+  static_assert(N >= 2, "a lookup table needs at least two breakpoints");
+
+ public:
+  constexpr FixedLookupTable1D(const double (&breakpoints)[N], const double (&values)[N]) {
+    for (size_t i = 0; i < N; i++) {
+      this->breakpoints[i] = breakpoints[i];
+      this->values[i] = values[i];
+    }
+
+    const double spacing = breakpoints[1] - breakpoints[0];
+    uniform = spacing > 0;
+    for (size_t i = 2; i < N && uniform; i++) {
+      uniform = (breakpoints[i] - breakpoints[i - 1]) == spacing;
+    }
+    inverseSpacing = uniform ? 1.0 / spacing : 0;
+  }
+
+  [[nodiscard]] constexpr double get(double u) const {
+    size_t index;
+    double fraction;
+
+    if (u <= breakpoints[0]) {
+      index = 0;
+      fraction = (u - breakpoints[0]) / (breakpoints[1] - breakpoints[0]);
+    } else if (u < breakpoints[N - 1]) {
+      index = findInterval(u);
+      fraction = (u - breakpoints[index]) / (breakpoints[index + 1] - breakpoints[index]);
+    } else {
+      index = N - 2;
+      fraction = (u - breakpoints[N - 2]) / (breakpoints[N - 1] - breakpoints[N - 2]);
+    }
+
+    const double lower = values[index];
+    return (values[index + 1] - lower) * fraction + lower;
+  }
+
+  [[nodiscard]] constexpr bool isUniform() const { return uniform; }
+
+ private:
+  static constexpr size_t LINEAR_SCAN_MAX_SIZE = 8;
+
+  // Returns the interval with breakpoints[index] <= u < breakpoints[index + 1], u must lie inside the table.
+  [[nodiscard]] constexpr size_t findInterval(double u) const {
+    if (uniform) {
+      // the estimate can be off by one due to rounding, the comparisons make the result exact
+      size_t index = static_cast<size_t>((u - breakpoints[0]) * inverseSpacing);
+      if (index > N - 2) {
+        index = N - 2;
+      }
+      while (index > 0 && u < breakpoints[index]) {
+        index--;
+      }
+      while (index < N - 2 && u >= breakpoints[index + 1]) {
+        index++;
+      }
+      return index;
+    }
+
+    if constexpr (N <= LINEAR_SCAN_MAX_SIZE) {
+      size_t index = 0;
+      for (size_t i = 1; i < N - 1; i++) {
+        index += u >= breakpoints[i] ? 1 : 0;
+      }
+      return index;
+    } else {
+      size_t left = 0;
+      size_t right = N - 1;
+      while (right - left > 1) {
+        const size_t middle = (left + right) >> 1;
+        if (u < breakpoints[middle]) {
+          right = middle;
+        } else {
+          left = middle;
+        }
+      }
+      return left;
+    }
+  }
+
+  double breakpoints[N] = {};
+  double values[N] = {};
+  bool uniform = false;
+  double inverseSpacing = 0;
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cmath>
+
+// Spherical earth geometry between an aircraft and a ground station, e.g. for localizer and glide slope deviation.
+namespace Geodesy {
+
+constexpr double EARTH_RADIUS_METER = 6371e3;
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+
+// below this haversine term (about 127 km) asin is replaced by its series, the error stays below 0.1 mm
+constexpr double SMALL_ANGLE_HAVERSINE = 0.01;
+
+struct SinCos {
+  double sin;
+  double cos;
+};
+
+inline SinCos sincos(double x) {
+  return {std::sin(x), std::cos(x)};
+}
+
+// Position with the trigonometric terms of its latitude. The terms are only recomputed when the latitude changes, so
+// a position kept for a fixed station costs nothing after the first update.
+class Position {
+ public:
+  Position() = default;
+
+  Position(double latitude_deg, double longitude_deg, double altitude_m) { set(latitude_deg, longitude_deg, altitude_m); }
+
+  void set(double latitude_deg, double longitude_deg, double altitude_m) {
+    if (!initialized || latitude_deg != latitude) {
+      const SinCos latitudeTerms = sincos(latitude_deg * DEG_TO_RAD);
+      sinLatitude = latitudeTerms.sin;
+      cosLatitude = latitudeTerms.cos;
+      initialized = true;
+    }
+    latitude = latitude_deg;
+    longitude = longitude_deg;
+    altitude = altitude_m;
+  }
+
+  [[nodiscard]] double getLatitude() const { return latitude; }
+  [[nodiscard]] double getLongitude() const { return longitude; }
+  [[nodiscard]] double getAltitude() const { return altitude; }
+  [[nodiscard]] double getSinLatitude() const { return sinLatitude; }
+  [[nodiscard]] double getCosLatitude() const { return cosLatitude; }
+
+ private:
+  double latitude = 0;
+  double longitude = 0;
+  double altitude = 0;
+  double sinLatitude = 0;
+  double cosLatitude = 1;
+  bool initialized = false;
+};
+
+struct Geometry {
+  // great circle distance
+  double distance_m;
+  // distance including the altitude difference
+  double slantDistance_m;
+  // initial true bearing from the first to the second position in [0, 360)
+  double bearing_deg;
+};
+
+// Haversine distance and initial bearing. The sine and cosine of the longitude difference are derived from its half
+// angle, which the haversine needs anyway, so only two sines, a cosine and an atan2 are evaluated per call.
+inline Geometry relative(const Position& from, const Position& to) {
+  const double sinHalfDeltaLatitude = std::sin((to.getLatitude() - from.getLatitude()) * DEG_TO_RAD / 2.0);
+  const SinCos halfDeltaLongitude = sincos((to.getLongitude() - from.getLongitude()) * DEG_TO_RAD / 2.0);
+
+  const double cosLatitudes = from.getCosLatitude() * to.getCosLatitude();
+  const double a = sinHalfDeltaLatitude * sinHalfDeltaLatitude + cosLatitudes * halfDeltaLongitude.sin * halfDeltaLongitude.sin;
+  const double h = std::sqrt(std::fmin(a, 1.0));
+
+  // 2 * asin(sqrt(a)), the same as 2 * atan2(sqrt(a), sqrt(1 - a))
+  const double c = h < SMALL_ANGLE_HAVERSINE ? 2.0 * (h + h * h * h / 6.0) : 2.0 * std::asin(h);
+
+  const double distance = EARTH_RADIUS_METER * c;
+  const double deltaAltitude = from.getAltitude() - to.getAltitude();
+
+  const double sinDeltaLongitude = 2.0 * halfDeltaLongitude.sin * halfDeltaLongitude.cos;
+  const double cosDeltaLongitude = 1.0 - 2.0 * halfDeltaLongitude.sin * halfDeltaLongitude.sin;
+  const double y = sinDeltaLongitude * to.getCosLatitude();
+  const double x = from.getCosLatitude() * to.getSinLatitude() - from.getSinLatitude() * to.getCosLatitude() * cosDeltaLongitude;
+
+  return Geometry{distance, std::sqrt(distance * distance + deltaAltitude * deltaAltitude),
+                  std::fmod(std::atan2(y, x) * RAD_TO_DEG + 360.0, 360.0)};
+}
+
+}  // namespace Geodesy
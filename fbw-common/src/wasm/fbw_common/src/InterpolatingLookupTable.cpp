@@ -1,39 +1,51 @@
 #include "InterpolatingLookupTable.h"
 
 void InterpolatingLookupTable::initialize(std::vector<std::pair<double, double>> mapping, double minimum, double maximum) {
-  mappingTable = std::move(mapping);
+  breakpoints.clear();
+  values.clear();
+  for (const auto& [breakpoint, value] : mapping) {
+    breakpoints.push_back(breakpoint);
+    values.push_back(value);
+  }
+
+  // a mapping with breakpoints out of order (e.g. overlapping user detents) is scanned like before
+  ordered = std::is_sorted(breakpoints.begin(), breakpoints.end());
+
   mappingMinimum = minimum;
   mappingMaximum = maximum;
+  lastIndex = 0;
 }
 
 double InterpolatingLookupTable::get(double value) {
-  if (mappingTable.empty()) {
+  if (breakpoints.size() < 2) {
     // not initialized yet
     return 0;
   }
 
+  if (!ordered) {
+    return getUnordered(value);
+  }
+
+  if (!(value >= breakpoints.front() && value <= breakpoints.back())) {
+    // not in range
+    return 0;
+  }
+
+  if (!InterpolatingLookup::isInSegment(breakpoints.data(), lastIndex, value)) {
+    lastIndex = InterpolatingLookup::findSegment(breakpoints.data(), breakpoints.size(), value);
+  }
+
+  double result = InterpolatingLookup::interpolate(breakpoints[lastIndex], values[lastIndex], breakpoints[lastIndex + 1],
+                                                   values[lastIndex + 1], value);
+  return InterpolatingLookup::clip(result, mappingMinimum, mappingMaximum);
+}
+
+double InterpolatingLookupTable::getUnordered(double value) const {
   // iterate over values and do interpolation
-  for (std::size_t i = 0; i < mappingTable.size() - 1; ++i) {
-    if (mappingTable[i].first <= value && mappingTable[i + 1].first >= value) {
-      // calculate differences
-      double diff_x = value - mappingTable[i].first;
-      double diff_n = mappingTable[i + 1].first - mappingTable[i].first;
-
-      // interpolation
-      double result = mappingTable[i].first;
-      if (diff_n != 0) {
-        result = mappingTable[i].second + (mappingTable[i + 1].second - mappingTable[i].second) * diff_x / diff_n;
-      }
-
-      // clip the result to minimum and maximum
-      if (result < mappingMinimum) {
-        return mappingMinimum;
-      } else if (result > mappingMaximum) {
-        return mappingMaximum;
-      }
-
-      // no clipping needed -> return result
-      return result;
+  for (std::size_t i = 0; i < breakpoints.size() - 1; ++i) {
+    if (breakpoints[i] <= value && breakpoints[i + 1] >= value) {
+      double result = InterpolatingLookup::interpolate(breakpoints[i], values[i], breakpoints[i + 1], values[i + 1], value);
+      return InterpolatingLookup::clip(result, mappingMinimum, mappingMaximum);
     }
   }
 
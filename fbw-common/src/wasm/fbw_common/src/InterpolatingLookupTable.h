@@ -1,8 +1,41 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+namespace InterpolatingLookup {
+
+// Returns the first segment [breakpoints[i], breakpoints[i + 1]] containing the value. The breakpoints must be in
+// ascending order and the value must be within them.
+constexpr std::size_t findSegment(const double* breakpoints, std::size_t size, double value) {
+  const auto index = static_cast<std::size_t>(std::lower_bound(breakpoints, breakpoints + size, value) - breakpoints);
+  return index > 0 ? index - 1 : 0;
+}
+
+// Checks if the segment is the first one containing the value, for breakpoints in ascending order.
+constexpr bool isInSegment(const double* breakpoints, std::size_t index, double value) {
+  return (breakpoints[index] < value || (index == 0 && breakpoints[0] == value)) && value <= breakpoints[index + 1];
+}
+
+// Interpolates within a segment, a segment of zero width returns its breakpoint.
+constexpr double interpolate(double x0, double y0, double x1, double y1, double x) {
+  const double diff_n = x1 - x0;
+  return diff_n != 0 ? y0 + (y1 - y0) * (x - x0) / diff_n : x0;
+}
+
+constexpr double clip(double value, double minimum, double maximum) {
+  return value < minimum ? minimum : (value > maximum ? maximum : value);
+}
+
+}  // namespace InterpolatingLookup
+
+// Piecewise linear mapping with the result clipped to [minimum, maximum], values outside of the mapping return 0.
+// The mapping is used in the order it is given, the first segment containing the value is interpolated. If the
+// breakpoints are in ascending order, the segment of the previous lookup is tried first and a binary search is used
+// otherwise, so consecutive lookups of a slowly changing value (e.g. axis events) do not need to scan the mapping.
 class InterpolatingLookupTable {
  public:
   InterpolatingLookupTable() = default;
@@ -12,7 +45,45 @@ class InterpolatingLookupTable {
   double get(double value);
 
  private:
-  std::vector<std::pair<double, double>> mappingTable;
+  double getUnordered(double value) const;
+
+  std::vector<double> breakpoints;
+  std::vector<double> values;
+  bool ordered = false;
   double mappingMinimum = 0;
   double mappingMaximum = 0;
+  std::size_t lastIndex = 0;
+};
+
+// Same mapping as InterpolatingLookupTable for a fixed number of breakpoints, which can be built at compile time.
+// The breakpoints must be given in ascending order.
+template <std::size_t N>
+class FixedInterpolatingLookupTable {
+  static_assert(N >= 2, "a lookup table needs at least two breakpoints");
+
+ public:
+  constexpr FixedInterpolatingLookupTable(const std::pair<double, double> (&mapping)[N], double minimum, double maximum)
+      : mappingMinimum(minimum), mappingMaximum(maximum) {
+    for (std::size_t i = 0; i < N; i++) {
+      breakpoints[i] = mapping[i].first;
+      values[i] = mapping[i].second;
+    }
+  }
+
+  [[nodiscard]] constexpr double get(double value) const {
+    if (!(value >= breakpoints[0] && value <= breakpoints[N - 1])) {
+      return 0;
+    }
+
+    const std::size_t i = InterpolatingLookup::findSegment(breakpoints.data(), N, value);
+    return InterpolatingLookup::clip(
+        InterpolatingLookup::interpolate(breakpoints[i], values[i], breakpoints[i + 1], values[i + 1], value), mappingMinimum,
+        mappingMaximum);
+  }
+
+ private:
+  std::array<double, N> breakpoints = {};
+  std::array<double, N> values = {};
+  double mappingMinimum;
+  double mappingMaximum;
 };
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cmath>
+
+// Runs a group of models at a fixed rate independent of the frame rate. Frame time is accumulated and the group is
+// stepped once per full period that has elapsed, always with the period as step time. The remainder is carried to the
+// next frame. A rate of zero disables the limiting and the group is stepped once per frame with the frame time.
+// At most MAX_STEPS_PER_UPDATE steps are run per frame, time beyond that is dropped so that a long frame, e.g. after a
+// stall or at a high simulation rate, is not caught up with.
+// The accumulated time has to be reset when the group is not updated for a while, e.g. in pause or slew, as it would
+// otherwise be caught up with afterwards.
+class ModelRateGroup {
+ public:
+  static constexpr int MAX_STEPS_PER_UPDATE = 8;
+
+  void setRate(double rateHz) { period = rateHz > 0 ? 1.0 / rateHz : 0; }
+
+  void reset() { accumulatedTime = 0; }
+
+  // Returns the number of steps to run in this frame, each with getStepTime() as sample time.
+  int update(double dt) {
+    if (period <= 0) {
+      stepTime = dt;
+      accumulatedTime = 0;
+      return 1;
+    }
+
+    accumulatedTime += dt;
+    stepTime = period;
+
+    int steps = static_cast<int>(std::floor(accumulatedTime / period));
+    if (steps > MAX_STEPS_PER_UPDATE) {
+      steps = MAX_STEPS_PER_UPDATE;
+      accumulatedTime = 0;
+    } else {
+      accumulatedTime -= steps * period;
+    }
+    return steps;
+  }
+
+  [[nodiscard]] double getStepTime() const { return stepTime; }
+
+  // Fraction of the current period that has elapsed since the last step, used to interpolate outputs between steps.
+  [[nodiscard]] double getInterpolationFactor() const { return period > 0 ? std::fmin(1.0, accumulatedTime / period) : 1.0; }
+
+ private:
+  double period = 0;
+  double accumulatedTime = 0;
+  double stepTime = 0;
+};
@@ -6,7 +6,7 @@ DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
 OUTPUT="${DIR}/out/terronnd.wasm"
 
 if [ "$1" == "--debug" ]; then
-  CLANG_ARGS="-g"
+  CLANG_ARGS="-g -DTERRONND_FRAME_STATISTICS"
 else
   WASMLD_ARGS="--strip-debug"
 fi
@@ -55,10 +55,14 @@ clang++ \
   -O2 \
   -I "${MSFS_SDK}/WASM/include" \
   -I "${MSFS_SDK}/SimConnect SDK/include" \
+  -I "${DIR}/../cpp-msfs-framework/lib" \
+  -I "${DIR}/../fbw_common/src" \
   "${DIR}/src/main.cpp" \
   "${DIR}/src/nanovg/nanovg.cpp" \
   "${DIR}/src/navigationdisplay/collection.cpp" \
   "${DIR}/src/navigationdisplay/displaybase.cpp" \
+  "${DIR}/src/navigationdisplay/framedecoder.cpp" \
+  "${DIR}/src/navigationdisplay/framestatistics.cpp" \
   "${DIR}/src/simconnect/connection.cpp" \
 
 # restore directory
@@ -41,8 +41,8 @@ MSFS_CALLBACK bool terronnd_gauge_callback(FsContext ctx, int service_id, void*
         return false;
       }
 
-      displays->updateDisplay(ctx);
-      displays->renderDisplay((sGaugeDrawData*)pData, ctx);
+      displays->updateDisplay(ctx, static_cast<sGaugeDrawData*>(pData)->t);
+      displays->renderDisplay(static_cast<sGaugeDrawData*>(pData), ctx);
       break;
     case PANEL_SERVICE_PRE_KILL: {
       connection.disconnect();
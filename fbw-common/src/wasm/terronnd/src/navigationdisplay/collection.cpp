@@ -1,3 +1,6 @@
+#include <cmath>
+#include <cstring>
+
 #include "collection.h"
 
 using namespace navigationdisplay;
@@ -8,10 +11,12 @@ Collection::Collection(simconnect::Connection& connection)
       _egpwcData(),
       _configurationLeft(),
       _configurationRight(),
-      _lastAircraftStatusTransmission(),
+      _lastAircraftStatusTransmission(0.0),
       _sendAircraftStatus(false),
       _reconfigureDisplayLeft(false),
       _reconfigureDisplayRight(false),
+      _frameSequenceLeft(0),
+      _frameSequenceRight(0),
       _simulatorData(nullptr),
       _aircraftStatus(nullptr),
       _ndConfiguration(nullptr),
@@ -47,37 +52,51 @@ Collection::Collection(simconnect::Connection& connection)
                                                  EfisNdRightMode, EgpwcTerrOnNdRightActive, AcEssBus, Ac2Bus>();
   this->_ndConfiguration->setUpdateCycleTime(200 * types::millisecond);
   this->_ndConfiguration->setOnChangeCallback([=]() {
-    this->_configurationLeft.range = static_cast<float>(this->_ndConfiguration->value<EgpwcNdLeftRange>()) * types::nauticmile;
-    this->_configurationLeft.mode = static_cast<std::uint8_t>(this->_ndConfiguration->value<EfisNdLeftMode>());
-    this->_configurationLeft.terrainActive = static_cast<std::uint8_t>(this->_ndConfiguration->value<EgpwcTerrOnNdLeftActive>()) != 0;
-    this->_configurationLeft.powered = static_cast<std::uint8_t>(this->_ndConfiguration->value<AcEssBus>()) != 0;
-
-    this->_configurationRight.range = static_cast<float>(this->_ndConfiguration->value<EgpwcNdRightRange>()) * types::nauticmile;
-    this->_configurationRight.mode = static_cast<std::uint8_t>(this->_ndConfiguration->value<EfisNdRightMode>());
-    this->_configurationRight.terrainActive = static_cast<std::uint8_t>(this->_ndConfiguration->value<EgpwcTerrOnNdRightActive>()) != 0;
-    this->_configurationRight.powered = static_cast<std::uint8_t>(this->_ndConfiguration->value<Ac2Bus>()) != 0;
-
-    this->_reconfigureDisplayLeft = true;
-    this->_reconfigureDisplayRight = true;
+    DisplayBase::NdConfiguration left = this->_configurationLeft;
+    left.range = static_cast<float>(this->_ndConfiguration->value<EgpwcNdLeftRange>()) * types::nauticmile;
+    left.mode = static_cast<std::uint8_t>(this->_ndConfiguration->value<EfisNdLeftMode>());
+    left.terrainActive = static_cast<std::uint8_t>(this->_ndConfiguration->value<EgpwcTerrOnNdLeftActive>()) != 0;
+    left.powered = static_cast<std::uint8_t>(this->_ndConfiguration->value<AcEssBus>()) != 0;
+
+    DisplayBase::NdConfiguration right = this->_configurationRight;
+    right.range = static_cast<float>(this->_ndConfiguration->value<EgpwcNdRightRange>()) * types::nauticmile;
+    right.mode = static_cast<std::uint8_t>(this->_ndConfiguration->value<EfisNdRightMode>());
+    right.terrainActive = static_cast<std::uint8_t>(this->_ndConfiguration->value<EgpwcTerrOnNdRightActive>()) != 0;
+    right.powered = static_cast<std::uint8_t>(this->_ndConfiguration->value<Ac2Bus>()) != 0;
+
+    this->_reconfigureDisplayLeft |= Collection::configurationChanged(this->_configurationLeft, left);
+    this->_reconfigureDisplayRight |= Collection::configurationChanged(this->_configurationRight, right);
+    this->_configurationLeft = left;
+    this->_configurationRight = right;
     this->_sendAircraftStatus = true;
   });
 
+  // the position changes in every frame while moving, so the data is only sent if something changed
   this->_simulatorData = connection.simObject<types::SimulatorData>();
   this->_simulatorData->addEntry("PLANE LATITUDE", "degrees");
   this->_simulatorData->addEntry("PLANE LONGITUDE", "degrees");
   this->_simulatorData->addEntry(LightPotentiometerLeftName, "percent over 100");
   this->_simulatorData->addEntry(LightPotentiometerRightName, "percent over 100");
   this->_simulatorData->defineObject();
-  this->_simulatorData->requestData(SIMCONNECT_PERIOD_VISUAL_FRAME);
+  this->_simulatorData->requestData(SIMCONNECT_PERIOD_VISUAL_FRAME, true);
   this->_simulatorData->setOnChangeCallback([=]() {
-    this->_configurationLeft.potentiometer = static_cast<float>(this->_simulatorData->data().potentiometerLeft);
-    this->_configurationRight.potentiometer = static_cast<float>(this->_simulatorData->data().potentiometerRight);
-    this->_reconfigureDisplayLeft = true;
-    this->_reconfigureDisplayRight = true;
+    const float potentiometerLeft = static_cast<float>(this->_simulatorData->data().potentiometerLeft);
+    const float potentiometerRight = static_cast<float>(this->_simulatorData->data().potentiometerRight);
+    if (potentiometerLeft != this->_configurationLeft.potentiometer) {
+      this->_configurationLeft.potentiometer = potentiometerLeft;
+      this->_reconfigureDisplayLeft = true;
+    }
+    if (potentiometerRight != this->_configurationRight.potentiometer) {
+      this->_configurationRight.potentiometer = potentiometerRight;
+      this->_reconfigureDisplayRight = true;
+    }
 
     types::Angle latitude = static_cast<float>(this->_simulatorData->data().latitude) * types::degree;
     types::Angle longitude = static_cast<float>(this->_simulatorData->data().longitude) * types::degree;
-    if (latitude != this->_groundTruth.latitude || longitude != this->_groundTruth.longitude) {
+    if (Collection::quantizePosition(latitude.convert(types::degree)) !=
+            Collection::quantizePosition(this->_groundTruth.latitude.convert(types::degree)) ||
+        Collection::quantizePosition(longitude.convert(types::degree)) !=
+            Collection::quantizePosition(this->_groundTruth.longitude.convert(types::degree))) {
       this->_groundTruth.latitude = latitude;
       this->_groundTruth.longitude = longitude;
       this->_sendAircraftStatus = true;
@@ -106,57 +125,89 @@ void Collection::destroy() {
   this->_displays.clear();
 }
 
-void Collection::updateDisplay(FsContext context) {
-  const auto now = std::chrono::system_clock::now();
-  const auto dt =
-      static_cast<float>(std::chrono::duration_cast<std::chrono::milliseconds>(now - this->_lastAircraftStatusTransmission).count()) *
-      types::millisecond;
-
-  if (this->_sendAircraftStatus && dt >= 100 * types::millisecond) {
-    this->_simconnectAircraftStatus->data().adiruValid = this->_egpwcData.presentLatitude.isNo() &&
-                                                         this->_egpwcData.presentLongitude.isNo() && this->_egpwcData.altitude.isNo() &&
-                                                         this->_egpwcData.heading.isNo() && this->_egpwcData.verticalSpeed.isNo();
-    this->_simconnectAircraftStatus->data().latitude = this->_egpwcData.presentLatitude.value().convert(types::degree);
-    this->_simconnectAircraftStatus->data().longitude = this->_egpwcData.presentLongitude.value().convert(types::degree);
-    this->_simconnectAircraftStatus->data().altitude = static_cast<std::int32_t>(this->_egpwcData.altitude.value().convert(types::feet));
-    this->_simconnectAircraftStatus->data().heading = static_cast<std::int16_t>(this->_egpwcData.heading.value().convert(types::degree));
-    this->_simconnectAircraftStatus->data().verticalSpeed =
-        static_cast<std::int16_t>(this->_egpwcData.verticalSpeed.value().convert(types::ftpmin));
-    this->_simconnectAircraftStatus->data().gearIsDown = static_cast<std::uint8_t>(this->_egpwcData.gearIsDown);
-
-    this->_simconnectAircraftStatus->data().destinationValid =
-        this->_egpwcData.destinationLatitude.isNo() && this->_egpwcData.destinationLongitude.isNo();
-    this->_simconnectAircraftStatus->data().destinationLatitude = this->_egpwcData.destinationLatitude.value().convert(types::degree);
-    this->_simconnectAircraftStatus->data().destinationLongitude = this->_egpwcData.destinationLongitude.value().convert(types::degree);
-
-    bool arcMode = this->_configurationLeft.mode == NavigationDisplayArcModeId;
-    bool terrainMapMode = this->_configurationLeft.mode == NavigationDisplayRoseLsModeId ||
-                          this->_configurationLeft.mode == NavigationDisplayRoseVorModeId ||
-                          this->_configurationLeft.mode == NavigationDisplayRoseNavModeId || arcMode;
-    this->_simconnectAircraftStatus->data().ndRangeCapt =
-        static_cast<std::uint16_t>(this->_configurationLeft.range.convert(types::nauticmile));
-    this->_simconnectAircraftStatus->data().ndArcModeCapt = this->_configurationLeft.mode == NavigationDisplayArcModeId;
-    this->_simconnectAircraftStatus->data().ndTerrainOnNdActiveCapt =
-        static_cast<std::uint8_t>(this->_configurationLeft.terrainActive && terrainMapMode);
-    this->_simconnectAircraftStatus->data().efisModeCapt = this->_configurationLeft.mode;
-
-    arcMode = this->_configurationRight.mode == NavigationDisplayArcModeId;
-    terrainMapMode = this->_configurationRight.mode == NavigationDisplayRoseLsModeId ||
-                     this->_configurationRight.mode == NavigationDisplayRoseVorModeId ||
-                     this->_configurationRight.mode == NavigationDisplayRoseNavModeId || arcMode;
-    this->_simconnectAircraftStatus->data().ndRangeFO =
-        static_cast<std::uint16_t>(this->_configurationRight.range.convert(types::nauticmile));
-    this->_simconnectAircraftStatus->data().ndArcModeFO = this->_configurationRight.mode == NavigationDisplayArcModeId;
-    this->_simconnectAircraftStatus->data().ndTerrainOnNdActiveFO =
-        static_cast<std::uint8_t>(this->_configurationRight.terrainActive && terrainMapMode);
-    this->_simconnectAircraftStatus->data().efisModeFO = this->_configurationRight.mode;
-
-    this->_simconnectAircraftStatus->data().ndTerrainOnNdRenderingMode = this->_egpwcData.terrOnNdRenderingMode;
-    this->_simconnectAircraftStatus->data().groundTruthLatitude = this->_groundTruth.latitude.convert(types::degree);
-    this->_simconnectAircraftStatus->data().groundTruthLongitude = this->_groundTruth.longitude.convert(types::degree);
-
-    this->_simconnectAircraftStatus->setArea();
-    this->_lastAircraftStatusTransmission = now;
+float Collection::quantizePosition(float degrees) {
+  const float resolution = PositionResolution.convert(types::degree);
+  return std::round(degrees / resolution) * resolution;
+}
+
+bool Collection::configurationChanged(const DisplayBase::NdConfiguration& current, const DisplayBase::NdConfiguration& next) {
+  return current.range != next.range || current.mode != next.mode || current.terrainActive != next.terrainActive ||
+         current.potentiometer != next.potentiometer || current.powered != next.powered;
+}
+
+bool Collection::aircraftStatusChanged(const types::AircraftStatusData& current, const types::AircraftStatusData& next) {
+  // the positions are sent as they are, only movements above the resolution are a change
+  types::AircraftStatusData quantizedCurrent = current;
+  types::AircraftStatusData quantizedNext = next;
+  for (auto* status : {&quantizedCurrent, &quantizedNext}) {
+    status->latitude = Collection::quantizePosition(status->latitude);
+    status->longitude = Collection::quantizePosition(status->longitude);
+    status->destinationLatitude = Collection::quantizePosition(status->destinationLatitude);
+    status->destinationLongitude = Collection::quantizePosition(status->destinationLongitude);
+    status->groundTruthLatitude = Collection::quantizePosition(status->groundTruthLatitude);
+    status->groundTruthLongitude = Collection::quantizePosition(status->groundTruthLongitude);
+  }
+
+  return std::memcmp(&quantizedCurrent, &quantizedNext, sizeof(types::AircraftStatusData)) != 0;
+}
+
+types::AircraftStatusData Collection::aircraftStatus() const {
+  types::AircraftStatusData status{};
+
+  status.adiruValid = this->_egpwcData.presentLatitude.isNo() && this->_egpwcData.presentLongitude.isNo() &&
+                      this->_egpwcData.altitude.isNo() && this->_egpwcData.heading.isNo() && this->_egpwcData.verticalSpeed.isNo();
+  status.latitude = this->_egpwcData.presentLatitude.value().convert(types::degree);
+  status.longitude = this->_egpwcData.presentLongitude.value().convert(types::degree);
+  status.altitude = static_cast<std::int32_t>(this->_egpwcData.altitude.value().convert(types::feet));
+  status.heading = static_cast<std::int16_t>(this->_egpwcData.heading.value().convert(types::degree));
+  status.verticalSpeed = static_cast<std::int16_t>(this->_egpwcData.verticalSpeed.value().convert(types::ftpmin));
+  status.gearIsDown = static_cast<std::uint8_t>(this->_egpwcData.gearIsDown);
+
+  status.destinationValid = this->_egpwcData.destinationLatitude.isNo() && this->_egpwcData.destinationLongitude.isNo();
+  status.destinationLatitude = this->_egpwcData.destinationLatitude.value().convert(types::degree);
+  status.destinationLongitude = this->_egpwcData.destinationLongitude.value().convert(types::degree);
+
+  bool arcMode = this->_configurationLeft.mode == NavigationDisplayArcModeId;
+  bool terrainMapMode = this->_configurationLeft.mode == NavigationDisplayRoseLsModeId ||
+                        this->_configurationLeft.mode == NavigationDisplayRoseVorModeId ||
+                        this->_configurationLeft.mode == NavigationDisplayRoseNavModeId || arcMode;
+  status.ndRangeCapt = static_cast<std::uint16_t>(this->_configurationLeft.range.convert(types::nauticmile));
+  status.ndArcModeCapt = this->_configurationLeft.mode == NavigationDisplayArcModeId;
+  status.ndTerrainOnNdActiveCapt = static_cast<std::uint8_t>(this->_configurationLeft.terrainActive && terrainMapMode);
+  status.efisModeCapt = this->_configurationLeft.mode;
+
+  arcMode = this->_configurationRight.mode == NavigationDisplayArcModeId;
+  terrainMapMode = this->_configurationRight.mode == NavigationDisplayRoseLsModeId ||
+                   this->_configurationRight.mode == NavigationDisplayRoseVorModeId ||
+                   this->_configurationRight.mode == NavigationDisplayRoseNavModeId || arcMode;
+  status.ndRangeFO = static_cast<std::uint16_t>(this->_configurationRight.range.convert(types::nauticmile));
+  status.ndArcModeFO = this->_configurationRight.mode == NavigationDisplayArcModeId;
+  status.ndTerrainOnNdActiveFO = static_cast<std::uint8_t>(this->_configurationRight.terrainActive && terrainMapMode);
+  status.efisModeFO = this->_configurationRight.mode;
+
+  status.ndTerrainOnNdRenderingMode = this->_egpwcData.terrOnNdRenderingMode;
+  status.groundTruthLatitude = this->_groundTruth.latitude.convert(types::degree);
+  status.groundTruthLongitude = this->_groundTruth.longitude.convert(types::degree);
+  status.ndTerrainOnNdFrameFormats = FrameDecoder::SupportedFormats;
+  status.ndTerrainOnNdFrameSequenceCapt = this->_frameSequenceLeft;
+  status.ndTerrainOnNdFrameSequenceFO = this->_frameSequenceRight;
+
+  return status;
+}
+
+void Collection::updateDisplay(FsContext context, double simulationTime) {
+  const types::Time dt = static_cast<float>(simulationTime - this->_lastAircraftStatusTransmission) * types::second;
+
+  // the simulation time jumps back if a new flight is loaded
+  if (this->_sendAircraftStatus && (dt >= AircraftStatusCycleTime || dt.value() < 0.0f)) {
+    const types::AircraftStatusData status = this->aircraftStatus();
+
+    // the client data area contains the last sent status
+    if (Collection::aircraftStatusChanged(this->_simconnectAircraftStatus->data(), status)) {
+      this->_simconnectAircraftStatus->data() = status;
+      this->_simconnectAircraftStatus->setArea();
+      this->_lastAircraftStatusTransmission = simulationTime;
+    }
     this->_sendAircraftStatus = false;
   }
 
@@ -171,12 +222,20 @@ void Collection::updateDisplay(FsContext context) {
           display->update(this->_configurationLeft);
           this->_reconfigureDisplayLeft = false;
         }
+        if (this->_frameSequenceLeft != display->frameSequence()) {
+          this->_frameSequenceLeft = display->frameSequence();
+          this->_sendAircraftStatus = true;
+        }
         break;
       case DisplaySide::Right:
         if (this->_reconfigureDisplayRight) {
           display->update(this->_configurationRight);
           this->_reconfigureDisplayRight = false;
         }
+        if (this->_frameSequenceRight != display->frameSequence()) {
+          this->_frameSequenceRight = display->frameSequence();
+          this->_sendAircraftStatus = true;
+        }
         break;
       default:
         break;
@@ -36,15 +36,22 @@ class Collection {
     types::Angle longitude;
   };
 
+  // the status is sent at most once per cycle and only if it changed
+  static constexpr types::Time AircraftStatusCycleTime = 100 * types::millisecond;
+  // position changes below the resolution are not sent to the SimBridge
+  static constexpr types::Angle PositionResolution = 0.0001f * types::degree;
+
   std::map<FsContext, std::shared_ptr<DisplayBase>> _displays;
   GroundTruthPosition _groundTruth;
   EgpwcData _egpwcData;
   DisplayBase::NdConfiguration _configurationLeft;
   DisplayBase::NdConfiguration _configurationRight;
-  std::chrono::system_clock::time_point _lastAircraftStatusTransmission;
+  double _lastAircraftStatusTransmission;
   bool _sendAircraftStatus;
   bool _reconfigureDisplayLeft;
   bool _reconfigureDisplayRight;
+  std::uint32_t _frameSequenceLeft;
+  std::uint32_t _frameSequenceRight;
 
   // inputs
   std::shared_ptr<simconnect::SimObject<types::SimulatorData>> _simulatorData;
@@ -71,6 +78,11 @@ class Collection {
   // outputs
   std::shared_ptr<simconnect::ClientDataArea<types::AircraftStatusData>> _simconnectAircraftStatus;
 
+  static float quantizePosition(float degrees);
+  static bool configurationChanged(const DisplayBase::NdConfiguration& current, const DisplayBase::NdConfiguration& next);
+  static bool aircraftStatusChanged(const types::AircraftStatusData& current, const types::AircraftStatusData& next);
+  types::AircraftStatusData aircraftStatus() const;
+
  public:
   /**
    * @brief Construct a new Collection object and initializes the communication objects
@@ -99,8 +111,9 @@ class Collection {
    * The Collection callbacks indicate if the displays need to be updated.
    * In this function are also the information for the SimBridge prepared and sent to it
    * @param context The gauge context
+   * @param simulationTime The absolute simulation time in seconds of the draw call
    */
-  void updateDisplay(FsContext context);
+  void updateDisplay(FsContext context, double simulationTime);
   /**
    * @brief Renders the terrain on ND or background image for a specific display
    * @param pDraw The pointer to the gauge draw data object
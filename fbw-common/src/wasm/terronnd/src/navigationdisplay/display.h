@@ -21,6 +21,10 @@
 #include "../types/quantity.hpp"
 #include "../types/simbridge.h"
 #include "configuration.h"
+#include "framedecoder.h"
+#ifdef TERRONND_FRAME_STATISTICS
+#include "framestatistics.h"
+#endif
 
 namespace navigationdisplay {
 
@@ -50,14 +54,20 @@ class DisplayBase {
   virtual void update(const NdConfiguration& config) = 0;
 
   DisplaySide side() const;
+  std::uint32_t frameSequence() const;
   void destroy();
   void render(sGaugeDrawData* pDrawData);
 
  protected:
   DisplaySide _side;
   NdConfiguration _configuration;
-  std::size_t _frameBufferSize;
+  FrameDecoder _frameDecoder;
+#ifdef TERRONND_FRAME_STATISTICS
+  FrameStatistics _frameStatistics;
+#endif
   int _nanovgImage;
+  int _imageWidth;
+  int _imageHeight;
   NVGcontext* _context;
   std::shared_ptr<simconnect::ClientDataArea<types::ThresholdData>> _thresholds;
   std::shared_ptr<simconnect::ClientDataAreaBuffered<std::uint8_t, SIMCONNECT_CLIENTDATA_MAX_SIZE>> _frameData;
@@ -65,6 +75,7 @@ class DisplayBase {
   DisplayBase(DisplaySide side, FsContext context);
 
   void destroyImage();
+  void updateImage();
 };
 
 /**
@@ -98,6 +109,8 @@ class Display : public DisplayBase {
    * Communcation concept to the SimBridge:
    *  - The threshold data block from the SimBridge contains the number of bytes for a frame
    *  - The framedata is sent afterwards in chunks of SIMCONNECT_CLIENTDATA_MAX_SIZE bytes per chunk, until the frame is transmitted
+   *  - The framedata is an encoded image or an indexed frame, if the SimBridge supports the formats announced in the aircraft status
+   *  - Indexed delta frames only contain the changed regions and are patched into the displayed frame
    *
    * @param connection The connection to SimCommect
    * @param side The display side
@@ -113,15 +126,11 @@ class Display : public DisplayBase {
     this->_frameData->defineArea(side == DisplaySide::Left ? FrameDataLeftName : FrameDataRightName);
     this->_frameData->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
     this->_frameData->setOnChangeCallback([=]() {
-      this->destroyImage();
-
       if (!this->_ignoreNextFrame && this->_configuration.terrainActive) {
-        this->_nanovgImage =
-            nvgCreateImageMem(this->_context, 0, this->_frameData->data().data(), static_cast<int>(this->_frameBufferSize));
-        if (this->_nanovgImage == 0) {
-          std::cerr << "TERR ON ND: Unable to decode the image from the stream" << std::endl;
-        }
+        this->updateImage();
       } else {
+        this->_frameDecoder.reset();
+        this->destroyImage();
         this->resetNavigationDisplayData();
       }
     });
@@ -131,8 +140,10 @@ class Display : public DisplayBase {
     this->_thresholds->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
     this->_thresholds->setAlwaysChanges(true);
     this->_thresholds->setOnChangeCallback([=]() {
-      this->_frameBufferSize = this->_thresholds->data().frameByteCount;
-      this->_frameData->reserve(this->_frameBufferSize);
+      this->_frameData->reserve(this->_thresholds->data().frameByteCount);
+#ifdef TERRONND_FRAME_STATISTICS
+      this->_frameStatistics.frameAnnounced();
+#endif
       this->_ignoreNextFrame =
           this->_ignoreNextFrame &&
           (this->_thresholds->data().firstFrame == 0 || this->_configuration.mode != this->_thresholds->data().displayMode ||
@@ -166,6 +177,7 @@ class Display : public DisplayBase {
 
     if (!this->_configuration.terrainActive || !validEfisMode || resetMapData) {
       this->resetNavigationDisplayData();
+      this->_frameDecoder.reset();
       this->destroyImage();
       this->_ignoreNextFrame = true;
     }
@@ -3,7 +3,18 @@
 using namespace navigationdisplay;
 
 DisplayBase::DisplayBase(DisplaySide side, FsContext context)
-    : _side(side), _configuration(), _frameBufferSize(0), _nanovgImage(0), _context(nullptr), _thresholds(nullptr), _frameData(nullptr) {
+    : _side(side),
+      _configuration(),
+      _frameDecoder(),
+#ifdef TERRONND_FRAME_STATISTICS
+      _frameStatistics(),
+#endif
+      _nanovgImage(0),
+      _imageWidth(0),
+      _imageHeight(0),
+      _context(nullptr),
+      _thresholds(nullptr),
+      _frameData(nullptr) {
   NVGparams params;
   params.userPtr = context;
   params.edgeAntiAlias = false;
@@ -14,6 +25,10 @@ DisplaySide DisplayBase::side() const {
   return this->_side;
 }
 
+std::uint32_t DisplayBase::frameSequence() const {
+  return this->_frameDecoder.sequence();
+}
+
 void DisplayBase::destroy() {
   this->destroyImage();
   nvgDeleteInternal(this->_context);
@@ -25,6 +40,58 @@ void DisplayBase::destroyImage() {
     nvgDeleteImage(this->_context, this->_nanovgImage);
     this->_nanovgImage = 0;
   }
+  this->_imageWidth = 0;
+  this->_imageHeight = 0;
+}
+
+void DisplayBase::updateImage() {
+  unsigned char* frame = this->_frameData->data().data();
+  const std::size_t frameSize = this->_frameData->data().size();
+
+#ifdef TERRONND_FRAME_STATISTICS
+  this->_frameStatistics.frameReceived();
+#endif
+  const FrameDecoder::Result result = this->_frameDecoder.decode(frame, frameSize);
+  switch (result) {
+    case FrameDecoder::Result::Decoded: {
+      const int width = static_cast<int>(this->_frameDecoder.width());
+      const int height = static_cast<int>(this->_frameDecoder.height());
+
+      // indexed frames are uploaded into the existing image as long as the frame size does not change
+      if (this->_nanovgImage != 0 && this->_imageWidth == width && this->_imageHeight == height) {
+        nvgUpdateImage(this->_context, this->_nanovgImage, this->_frameDecoder.pixels());
+      } else {
+        this->destroyImage();
+        this->_nanovgImage = nvgCreateImageRGBA(this->_context, width, height, 0, this->_frameDecoder.pixels());
+        if (this->_nanovgImage != 0) {
+          this->_imageWidth = width;
+          this->_imageHeight = height;
+        }
+      }
+      break;
+    }
+    case FrameDecoder::Result::NotIndexed:
+      this->_frameDecoder.reset();
+      this->destroyImage();
+      this->_nanovgImage = nvgCreateImageMem(this->_context, 0, frame, static_cast<int>(frameSize));
+      break;
+    case FrameDecoder::Result::OutOfSequence:
+      // keep the current image until the SimBridge sends a complete frame
+      break;
+    case FrameDecoder::Result::Invalid:
+    default:
+      this->destroyImage();
+      break;
+  }
+
+#ifdef TERRONND_FRAME_STATISTICS
+  this->_frameStatistics.frameDecoded(static_cast<char>(this->_side), FrameDecoder::format(frame, frameSize), frameSize, result,
+                                      this->_nanovgImage != 0, this->_frameData->droppedTransfers());
+#endif
+
+  if (result != FrameDecoder::Result::OutOfSequence && this->_nanovgImage == 0) {
+    std::cerr << "TERR ON ND: Unable to decode the image from the stream" << std::endl;
+  }
 }
 
 void DisplayBase::render(sGaugeDrawData* pDrawData) {
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cstring>
+
+#include "framedecoder.h"
+
+using namespace navigationdisplay;
+
+bool FrameDecoder::isIndexedFrame(const std::uint8_t* frame, std::size_t size) {
+  if (frame == nullptr || size < sizeof(types::FrameHeader)) {
+    return false;
+  }
+
+  std::uint32_t magic = 0;
+  std::memcpy(&magic, frame, sizeof(magic));
+  return magic == types::FrameHeaderMagic;
+}
+
+std::uint8_t FrameDecoder::format(const std::uint8_t* frame, std::size_t size) {
+  if (!FrameDecoder::isIndexedFrame(frame, size)) {
+    return types::FrameFormat::ENCODED_IMAGE;
+  }
+
+  types::FrameHeader header;
+  std::memcpy(&header, frame, sizeof(header));
+  return header.format;
+}
+
+FrameDecoder::Result FrameDecoder::decode(const std::uint8_t* frame, std::size_t size) {
+  if (!FrameDecoder::isIndexedFrame(frame, size)) {
+    return Result::NotIndexed;
+  }
+
+  types::FrameHeader header;
+  std::memcpy(&header, frame, sizeof(header));
+  if (header.width == 0 || header.height == 0 || header.paletteSize == 0 || header.paletteSize > this->_palette.size()) {
+    this->reset();
+    return Result::Invalid;
+  }
+
+  const std::size_t paletteBytes = header.paletteSize * sizeof(std::uint32_t);
+  if (size < sizeof(header) + paletteBytes) {
+    this->reset();
+    return Result::Invalid;
+  }
+
+  // a delta frame is only valid on top of the frame it was created from
+  const bool delta = header.format == types::FrameFormat::RUN_LENGTH_INDEXED_DELTA;
+  if (delta && (this->_sequence == 0 || header.sequence != this->_sequence + 1 || header.width != this->_width ||
+                header.height != this->_height)) {
+    return Result::OutOfSequence;
+  }
+
+  // unused palette entries stay transparent, so corrupt indices do not show up as terrain
+  this->_palette.fill(0);
+  std::memcpy(this->_palette.data(), frame + sizeof(header), paletteBytes);
+
+  const std::size_t pixelCount = static_cast<std::size_t>(header.width) * header.height;
+  if (this->_pixels.size() != pixelCount) {
+    this->_pixels.resize(pixelCount);
+  }
+  this->_width = header.width;
+  this->_height = header.height;
+
+  const std::uint8_t* data = frame + sizeof(header) + paletteBytes;
+  const std::size_t dataSize = size - sizeof(header) - paletteBytes;
+  bool decoded = false;
+  switch (header.format) {
+    case types::FrameFormat::RAW_INDEXED:
+      decoded = this->decodeRaw(data, dataSize);
+      break;
+    case types::FrameFormat::RUN_LENGTH_INDEXED:
+      decoded = this->decodeRunLength(data, dataSize, types::FrameRegion{0, 0, header.width, header.height}) != 0;
+      break;
+    case types::FrameFormat::RUN_LENGTH_INDEXED_DELTA:
+      decoded = this->decodeRegions(data, dataSize);
+      break;
+    default:
+      break;
+  }
+
+  // a partially decoded frame must not be the base of the next delta frame
+  this->_sequence = decoded ? header.sequence : 0;
+  return decoded ? Result::Decoded : Result::Invalid;
+}
+
+bool FrameDecoder::decodeRaw(const std::uint8_t* data, std::size_t size) {
+  if (size < this->_pixels.size()) {
+    return false;
+  }
+
+  std::uint32_t* pixel = this->_pixels.data();
+  for (std::size_t i = 0; i < this->_pixels.size(); ++i) {
+    pixel[i] = this->_palette[data[i]];
+  }
+
+  return true;
+}
+
+bool FrameDecoder::decodeRegions(const std::uint8_t* data, std::size_t size) {
+  std::uint16_t regionCount = 0;
+  if (size < sizeof(regionCount)) {
+    return false;
+  }
+  std::memcpy(&regionCount, data, sizeof(regionCount));
+
+  const std::size_t regionBytes = regionCount * sizeof(types::FrameRegion);
+  if (size < sizeof(regionCount) + regionBytes) {
+    return false;
+  }
+
+  const std::uint8_t* regions = data + sizeof(regionCount);
+  std::size_t offset = sizeof(regionCount) + regionBytes;
+  for (std::size_t i = 0; i < regionCount; ++i) {
+    types::FrameRegion region;
+    std::memcpy(&region, regions + i * sizeof(region), sizeof(region));
+    if (region.width == 0 || region.height == 0 || region.x + region.width > this->_width ||
+        region.y + region.height > this->_height) {
+      return false;
+    }
+
+    const std::size_t consumed = this->decodeRunLength(data + offset, size - offset, region);
+    if (consumed == 0) {
+      return false;
+    }
+    offset += consumed;
+  }
+
+  return true;
+}
+
+std::size_t FrameDecoder::decodeRunLength(const std::uint8_t* data, std::size_t size, const types::FrameRegion& region) {
+  std::size_t remainingPixels = static_cast<std::size_t>(region.width) * region.height;
+  std::size_t row = region.y;
+  std::size_t column = 0;
+  std::size_t i = 0;
+
+  for (; i + 1 < size && remainingPixels != 0; i += 2) {
+    std::size_t runLength = static_cast<std::size_t>(data[i]) + 1;
+    if (runLength > remainingPixels) {
+      return 0;
+    }
+    remainingPixels -= runLength;
+
+    // runs continue in the next row of the region
+    const std::uint32_t color = this->_palette[data[i + 1]];
+    while (runLength != 0) {
+      const std::size_t count = std::min(runLength, region.width - column);
+      std::fill_n(&this->_pixels[row * this->_width + region.x + column], count, color);
+      runLength -= count;
+      column += count;
+      if (column == region.width) {
+        column = 0;
+        ++row;
+      }
+    }
+  }
+
+  return remainingPixels == 0 ? i : 0;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../types/simbridge.h"
+
+namespace navigationdisplay {
+
+/**
+ * @brief Decodes palette-indexed terrain frames into a persistent RGBA buffer
+ *
+ * The buffer is kept between frames and only reallocated if the frame size changes,
+ * so it can be uploaded into an existing image without any allocation.
+ * Delta frames are patched into the buffer if they follow the decoded frame.
+ */
+class FrameDecoder {
+ public:
+  enum class Result { NotIndexed, Decoded, OutOfSequence, Invalid };
+
+  static constexpr std::uint8_t SupportedFormats = types::FrameFormat::ENCODED_IMAGE | types::FrameFormat::RAW_INDEXED |
+                                                   types::FrameFormat::RUN_LENGTH_INDEXED |
+                                                   types::FrameFormat::RUN_LENGTH_INDEXED_DELTA |
+                                                   types::FrameFormat::CHUNKED_WITH_HEADERS;
+
+ private:
+  std::array<std::uint32_t, 256> _palette;
+  std::vector<std::uint32_t> _pixels;
+  std::uint16_t _width;
+  std::uint16_t _height;
+  std::uint32_t _sequence;
+
+  bool decodeRaw(const std::uint8_t* data, std::size_t size);
+  bool decodeRegions(const std::uint8_t* data, std::size_t size);
+  std::size_t decodeRunLength(const std::uint8_t* data, std::size_t size, const types::FrameRegion& region);
+
+ public:
+  FrameDecoder() : _palette(), _pixels(), _width(0), _height(0), _sequence(0) {}
+  FrameDecoder(const FrameDecoder&) = delete;
+
+  FrameDecoder& operator=(const FrameDecoder&) = delete;
+
+  /**
+   * @brief Checks if a frame starts with the header of an indexed frame
+   * @param frame The received frame data
+   * @param size The number of bytes of the frame
+   * @return true if the frame is an indexed frame
+   * @return false if the frame is an encoded image or too short
+   */
+  static bool isIndexedFrame(const std::uint8_t* frame, std::size_t size);
+
+  /**
+   * @brief Returns the format of a frame
+   * @param frame The received frame data
+   * @param size The number of bytes of the frame
+   * @return std::uint8_t The format of an indexed frame or types::FrameFormat::ENCODED_IMAGE
+   */
+  static std::uint8_t format(const std::uint8_t* frame, std::size_t size);
+
+  /**
+   * @brief Decodes an indexed frame into the RGBA buffer
+   * @param frame The received frame data
+   * @param size The number of bytes of the frame
+   * @return Result::Decoded if the RGBA buffer contains the frame, Result::NotIndexed if the frame needs to be decoded as an
+   * image, Result::OutOfSequence if a delta frame does not follow the decoded frame and Result::Invalid if the frame is corrupt
+   */
+  Result decode(const std::uint8_t* frame, std::size_t size);
+
+  /**
+   * @brief Drops the decoded frame, so that only a complete frame is accepted next
+   */
+  void reset() { this->_sequence = 0; }
+
+  /**
+   * @brief Returns the sequence number of the decoded frame
+   * @return std::uint32_t The sequence number or 0 if no frame is decoded
+   */
+  std::uint32_t sequence() const { return this->_sequence; }
+
+  std::uint16_t width() const { return this->_width; }
+  std::uint16_t height() const { return this->_height; }
+
+  /**
+   * @brief Returns the decoded pixels in RGBA byte order
+   * @return const unsigned char* Pointer to width * height * 4 bytes
+   */
+  const unsigned char* pixels() const { return reinterpret_cast<const unsigned char*>(this->_pixels.data()); }
+};
+
+}  // namespace navigationdisplay
@@ -0,0 +1,104 @@
+#ifdef TERRONND_FRAME_STATISTICS
+
+#include <iostream>
+
+#include "framestatistics.h"
+
+using namespace navigationdisplay;
+
+FrameStatistics::FrameStatistics()
+    : _formats(),
+      _outOfSequenceFrames(0),
+      _invalidFrames(0),
+      _notIndexedFrames(0),
+      _announcedTime(),
+      _decodeStartTime(),
+      _intervalStartTime(Clock::now()),
+      _announced(false) {}
+
+std::size_t FrameStatistics::formatIndex(std::uint8_t format) {
+  switch (format) {
+    case types::FrameFormat::RAW_INDEXED:
+      return 1;
+    case types::FrameFormat::RUN_LENGTH_INDEXED:
+      return 2;
+    case types::FrameFormat::RUN_LENGTH_INDEXED_DELTA:
+      return 3;
+    case types::FrameFormat::ENCODED_IMAGE:
+    default:
+      return 0;
+  }
+}
+
+void FrameStatistics::frameAnnounced() {
+  this->_announcedTime = Clock::now();
+  this->_announced = true;
+}
+
+void FrameStatistics::frameReceived() {
+  this->_decodeStartTime = Clock::now();
+}
+
+void FrameStatistics::frameDecoded(char side,
+                                   std::uint8_t format,
+                                   std::size_t bytes,
+                                   FrameDecoder::Result result,
+                                   bool imageCreated,
+                                   std::size_t droppedTransfers) {
+  const auto now = Clock::now();
+
+  if (result == FrameDecoder::Result::OutOfSequence) {
+    this->_outOfSequenceFrames += 1;
+  } else if (result == FrameDecoder::Result::Invalid) {
+    this->_invalidFrames += 1;
+  } else if (result == FrameDecoder::Result::NotIndexed && !imageCreated) {
+    this->_notIndexedFrames += 1;
+  } else {
+    auto& statistics = this->_formats[FrameStatistics::formatIndex(format)];
+    statistics.frames += 1;
+    statistics.bytes += bytes;
+    statistics.decodeTime += now - this->_decodeStartTime;
+    // frames without a preceding announcement do not have a known start time
+    if (this->_announced) {
+      statistics.reassemblyTime += this->_decodeStartTime - this->_announcedTime;
+    }
+  }
+  this->_announced = false;
+
+  if (now - this->_intervalStartTime >= FrameStatistics::ReportInterval) {
+    this->report(side, droppedTransfers);
+    this->_formats = {};
+    this->_outOfSequenceFrames = 0;
+    this->_invalidFrames = 0;
+    this->_notIndexedFrames = 0;
+    this->_intervalStartTime = now;
+  }
+}
+
+namespace {
+float milliseconds(FrameStatistics::Clock::duration duration) {
+  return std::chrono::duration<float, std::milli>(duration).count();
+}
+}  // namespace
+
+void FrameStatistics::report(char side, std::size_t droppedTransfers) {
+  static constexpr std::array<const char*, 4> FormatNames = {"encoded", "raw indexed", "run-length", "run-length delta"};
+
+  const float interval = std::chrono::duration<float>(Clock::now() - this->_intervalStartTime).count();
+  for (std::size_t i = 0; i < this->_formats.size(); ++i) {
+    const auto& statistics = this->_formats[i];
+    if (statistics.frames == 0) {
+      continue;
+    }
+
+    const float frames = static_cast<float>(statistics.frames);
+    std::cout << "TERR ON ND: " << side << " " << FormatNames[i] << ": " << statistics.frames << " frames, "
+              << static_cast<float>(statistics.bytes) / interval << " bytes/s, " << static_cast<float>(statistics.bytes) / frames
+              << " bytes/frame, reassembly " << milliseconds(statistics.reassemblyTime) / frames << " ms/frame, decode "
+              << milliseconds(statistics.decodeTime) / frames << " ms/frame" << std::endl;
+  }
+  std::cout << "TERR ON ND: " << side << " out of sequence: " << this->_outOfSequenceFrames << ", invalid: " << this->_invalidFrames
+            << ", not indexed: " << this->_notIndexedFrames << ", dropped transfers: " << droppedTransfers << std::endl;
+}
+
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "framedecoder.h"
+
+namespace navigationdisplay {
+
+/**
+ * @brief Collects throughput and latency figures of the received terrain frames
+ *
+ * The figures are collected per frame format, so that the frame formats and streaming
+ * settings of the SimBridge can be compared with real traffic. A summary is written to
+ * the console in intervals. The statistics are only compiled into builds with
+ * TERRONND_FRAME_STATISTICS, so that release builds do not read the clock per frame.
+ *
+ * Frames without the header of an indexed frame are only counted as encoded images if the image
+ * can be decoded, all others are counted as not indexed frames.
+ */
+class FrameStatistics {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+ private:
+  struct FormatStatistics {
+    std::size_t frames;
+    std::size_t bytes;
+    Clock::duration reassemblyTime;
+    Clock::duration decodeTime;
+  };
+
+  static constexpr Clock::duration ReportInterval = std::chrono::seconds(30);
+
+  std::array<FormatStatistics, 4> _formats;
+  std::size_t _outOfSequenceFrames;
+  std::size_t _invalidFrames;
+  std::size_t _notIndexedFrames;
+  Clock::time_point _announcedTime;
+  Clock::time_point _decodeStartTime;
+  Clock::time_point _intervalStartTime;
+  bool _announced;
+
+  static std::size_t formatIndex(std::uint8_t format);
+  void report(char side, std::size_t droppedTransfers);
+
+ public:
+  FrameStatistics();
+  FrameStatistics(const FrameStatistics&) = delete;
+
+  FrameStatistics& operator=(const FrameStatistics&) = delete;
+
+  /**
+   * @brief Marks the start of a transfer when the SimBridge announces the next frame
+   */
+  void frameAnnounced();
+
+  /**
+   * @brief Marks the end of the reassembly and the start of the decoding of a frame
+   */
+  void frameReceived();
+
+  /**
+   * @brief Records a frame after it is decoded and uploaded and reports the statistics if the interval elapsed
+   * @param side The side of the display for the report
+   * @param format The format of the frame
+   * @param bytes The number of received bytes of the frame
+   * @param result The result of the decoder
+   * @param imageCreated True if the frame is uploaded into an image
+   * @param droppedTransfers The number of transfers that were dropped because of a lost chunk
+   */
+  void frameDecoded(char side,
+                    std::uint8_t format,
+                    std::size_t bytes,
+                    FrameDecoder::Result result,
+                    bool imageCreated,
+                    std::size_t droppedTransfers);
+};
+
+}  // namespace navigationdisplay
@@ -5,6 +5,7 @@
 #pragma clang diagnostic ignored "-Wundef"
 #include <SimConnect.h>
 #pragma clang diagnostic pop
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -13,6 +14,7 @@
 #include <vector>
 
 #include "../base/changeable.hpp"
+#include "ChunkReassembler.hpp"
 
 namespace simconnect {
 
@@ -169,6 +171,10 @@ class ClientDataArea : public ClientDataAreaBase {
 
 /**
  * @brief Defines a buffer-based client data area (i.e. frame data of terronnd)
+ *
+ * The received chunks are reassembled in a separate buffer, so data() always contains the last complete transfer.
+ * Transfers with a missing chunk are dropped if the sender adds chunk headers.
+ *
  * @tparam T The element type of one entry in the buffer
  * @tparam ChunkSize The number bytes that is used for the buffer-based communication
  */
@@ -177,27 +183,25 @@ class ClientDataAreaBuffered : public ClientDataAreaBase {
   friend Connection;
 
  private:
-  std::vector<T> _content;
-  std::size_t _expectedByteCount;
-  std::size_t _receivedBytes;
+  ChunkReassembler<T, ChunkSize> _reassembler;
 
   ClientDataAreaBuffered(HANDLE* connection, std::uint32_t dataId, std::uint32_t definitionId)
-      : ClientDataAreaBase(connection, dataId, definitionId), _content() {}
+      : ClientDataAreaBase(connection, dataId, definitionId), _reassembler() {}
   ClientDataAreaBuffered(const ClientDataAreaBuffered<T, ChunkSize>&) = delete;
 
   ClientDataAreaBuffered<T, ChunkSize>& operator=(const ClientDataAreaBuffered<T, ChunkSize>&) = delete;
 
   void receivedData(void* data) override {
-    std::size_t remainingBytes = this->_expectedByteCount - this->_receivedBytes;
-    if (remainingBytes > ChunkSize) {
-      remainingBytes = ChunkSize;
-    }
-
-    std::memcpy(&this->_content.data()[this->_receivedBytes], data, remainingBytes);
-    this->_receivedBytes += remainingBytes;
-
-    if (this->_receivedBytes >= this->_expectedByteCount) {
-      this->changed();
+    switch (this->_reassembler.receive(data)) {
+      case ChunkReassembler<T, ChunkSize>::Status::Complete:
+        this->changed();
+        break;
+      case ChunkReassembler<T, ChunkSize>::Status::Dropped:
+        std::cerr << "TERR ON ND: Dropped incomplete transfer after " << this->_reassembler.getReceivedBytes() << " of "
+                  << this->_reassembler.getExpectedBytes() << " bytes" << std::endl;
+        break;
+      default:
+        break;
     }
   }
 
@@ -230,19 +234,20 @@ class ClientDataAreaBuffered : public ClientDataAreaBase {
       return false;
     }
 
+    std::vector<T>& content = this->_reassembler.data();
     HRESULT result = S_OK;
     std::size_t sentBytes = 0;
 
-    while (sentBytes < this->_content.size()) {
-      std::size_t remainingBytes = this->_content.size() - sentBytes;
+    while (sentBytes < content.size()) {
+      std::size_t remainingBytes = content.size() - sentBytes;
 
       if (remainingBytes >= ChunkSize) {
         result &= SimConnect_SetClientData(*this->_connection, this->_dataId, this->_definitionId, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT,
-                                           0, ChunkSize, &this->_content.data()[sentBytes]);
+                                           0, ChunkSize, &content.data()[sentBytes]);
         sentBytes += ChunkSize;
       } else {
         std::array<T, ChunkSize> buffer{};
-        std::memcpy(buffer.data(), &this->_content.data()[sentBytes], remainingBytes);
+        std::memcpy(buffer.data(), &content.data()[sentBytes], remainingBytes);
         result &= SimConnect_SetClientData(*this->_connection, this->_dataId, this->_definitionId, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT,
                                            0, ChunkSize, buffer.data());
         sentBytes += remainingBytes;
@@ -253,26 +258,28 @@ class ClientDataAreaBuffered : public ClientDataAreaBase {
   }
 
   /**
-   * @brief Reserves internal data to receive the data
+   * @brief Starts the reception of a new transfer
    * @param expectedByteCount Number of expected bytes in streaming cases
    */
-  void reserve(std::size_t expectedByteCount) {
-    this->_expectedByteCount = expectedByteCount;
-    this->_content.reserve(expectedByteCount);
-    this->_receivedBytes = 0;
-  }
+  void reserve(std::size_t expectedByteCount) { this->_reassembler.expect(expectedByteCount); }
+
+  /**
+   * @brief Returns the number of transfers that were dropped because of a lost chunk
+   * @return std::size_t The number of dropped transfers
+   */
+  std::size_t droppedTransfers() const { return this->_reassembler.getDroppedTransfers(); }
 
   /**
    * @brief Returns a modifiable reference to the data container
    * @return std::vector<T>& Reference to the data container
    */
-  std::vector<T>& data() { return this->_content; }
+  std::vector<T>& data() { return this->_reassembler.data(); }
 
   /**
    * @brief Returns a constant reference to the data container
    * @return std::vector<T>& Reference to the data container
    */
-  const std::vector<T>& data() const { return this->_content; }
+  const std::vector<T>& data() const { return this->_reassembler.data(); }
 };
 
 }  // namespace simconnect
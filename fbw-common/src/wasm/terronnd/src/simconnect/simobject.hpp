@@ -39,16 +39,18 @@ class SimObjectBase : public base::Changeable {
   /**
    * @brief Requests data from the simconnect server
    * @param period The request period
+   * @param onlyChanges Flag if the data is only sent if it changed since the last period
    * @return true if the data is requested
    * @return false if something failed
    */
-  bool requestData(SIMCONNECT_PERIOD period) {
+  bool requestData(SIMCONNECT_PERIOD period, bool onlyChanges = false) {
     if (*this->_connection == 0) {
       return false;
     }
 
     HRESULT result;
-    result = SimConnect_RequestDataOnSimObject(*this->_connection, this->_dataId, this->_dataId, SIMCONNECT_OBJECT_ID_USER, period);
+    result = SimConnect_RequestDataOnSimObject(*this->_connection, this->_dataId, this->_dataId, SIMCONNECT_OBJECT_ID_USER, period,
+                                               onlyChanges ? SIMCONNECT_DATA_REQUEST_FLAG_CHANGED : SIMCONNECT_DATA_REQUEST_FLAG_DEFAULT);
     return SUCCEEDED(result);
   }
 };
@@ -81,8 +83,8 @@ class SimObject : public SimObjectBase {
   }
 
  public:
-  virtual ~SimObject<T>() {}
-  SimObject<T>(const SimObject<T>&) = delete;
+  virtual ~SimObject() {}
+  SimObject(const SimObject<T>&) = delete;
 
   SimObject<T>& operator=(const SimObject<T>&) = delete;
 
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include "Arinc429Codec.h"
+
 namespace types {
 
 /**
@@ -34,7 +36,7 @@ class Arinc429Word {
    * @brief Converts the word to a value that can be used to communicate with the simulator
    * @return double The resulting value
    */
-  double toSimVar() const { return *reinterpret_cast<double*>(this); }
+  double toSimVar() const { return Arinc429Codec::toSimVar(*this); }
 
   /**
    * @brief Returns the status flag
@@ -92,15 +94,7 @@ class Arinc429Word {
    * @param simVar The simulator value
    * @return Arinc429Word<T> The new word definition
    */
-  static Arinc429Word<T> fromSimVar(double simVar) {
-    const auto qWord = static_cast<std::uint64_t>(simVar);
-    const auto lowerDWord = static_cast<std::uint32_t>(qWord & 0xffffffff);
-
-    Arinc429Word<T> convertedWord;
-    convertedWord._rawSsm = static_cast<std::uint32_t>(qWord >> 32);
-    convertedWord._rawData = *reinterpret_cast<const T*>(&lowerDWord);
-    return std::move(convertedWord);
-  }
+  static Arinc429Word<T> fromSimVar(double simVar) { return Arinc429Codec::fromSimVar<Arinc429Word<T>>(simVar); }
 
   /**
    * @brief Converts a simulator value to the Arinc 429 word
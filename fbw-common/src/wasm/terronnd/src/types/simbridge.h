@@ -40,10 +40,68 @@ struct AircraftStatusData {
   std::uint8_t ndTerrainOnNdRenderingMode;
   float groundTruthLatitude;
   float groundTruthLongitude;
+  std::uint8_t ndTerrainOnNdFrameFormats;
+  std::uint32_t ndTerrainOnNdFrameSequenceCapt;
+  std::uint32_t ndTerrainOnNdFrameSequenceFO;
 } __attribute__((packed));
 
 enum ThresholdMode : std::uint8_t { PEAKS_MODE = 0, WARNING = 1, CAUTION = 2 };
 
+/**
+ * @brief The frame formats that the displays can decode
+ *
+ * The supported formats are announced as a bit mask in AircraftStatusData::ndTerrainOnNdFrameFormats.
+ * Encoded images (i.e. PNG) are always supported, the indexed formats start with a FrameHeader.
+ *
+ * Delta frames only contain the regions that changed since the previous indexed frame. They are applied if their sequence
+ * number directly follows the one of the displayed frame. The sequence number of the displayed frame is announced in
+ * AircraftStatusData::ndTerrainOnNdFrameSequenceCapt/FO (0 if no indexed frame is displayed), so that the SimBridge sends
+ * a complete frame if a delta frame was lost or ignored.
+ *
+ * CHUNKED_WITH_HEADERS is not a frame format but announces that the frame data chunks may start with a ChunkHeader,
+ * which allows the displays to drop frames with a lost chunk instead of showing a corrupted frame.
+ */
+enum FrameFormat : std::uint8_t {
+  ENCODED_IMAGE = 0x01,
+  RAW_INDEXED = 0x02,
+  RUN_LENGTH_INDEXED = 0x04,
+  RUN_LENGTH_INDEXED_DELTA = 0x08,
+  CHUNKED_WITH_HEADERS = 0x10
+};
+
+/**
+ * @brief Magic number at the start of an indexed frame ("TOND" in little endian)
+ */
+static constexpr std::uint32_t FrameHeaderMagic = 0x444e4f54;
+
+/**
+ * @brief The header in front of an indexed frame
+ *
+ * The header is followed by paletteSize RGBA palette entries and the pixel data in rows from top to bottom.
+ *  - RAW_INDEXED: one palette index per pixel
+ *  - RUN_LENGTH_INDEXED: pairs of a run length minus one and a palette index
+ *  - RUN_LENGTH_INDEXED_DELTA: the number of regions as std::uint16_t, the FrameRegion entries and the run length
+ *    encoded pixels of every region
+ */
+struct FrameHeader {
+  std::uint32_t magic;
+  std::uint8_t format;
+  std::uint16_t width;
+  std::uint16_t height;
+  std::uint16_t paletteSize;
+  std::uint32_t sequence;
+} __attribute__((packed));
+
+/**
+ * @brief A changed region of a delta frame in pixels
+ */
+struct FrameRegion {
+  std::uint16_t x;
+  std::uint16_t y;
+  std::uint16_t width;
+  std::uint16_t height;
+} __attribute__((packed));
+
 /**
  * @brief The threshold data that is received from the SimBridge for a new frame
  */
@@ -0,0 +1,21 @@
+#!/bin/bash
+
+# get directory of this script relative to root
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+
+set -e
+
+# go to right dir
+pushd "${DIR}"
+
+# create build files
+cmake -B build
+
+# build
+cmake --build build --config Release
+
+# compare the polynomials with the reference
+ctest --test-dir build --build-config Release --output-on-failure
+
+# restore directory
+popd
@@ -0,0 +1,147 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "Polynomials_A32NX.hpp"
+#include "Polynomials_A380X.hpp"
+#include "reference/Polynomials_A32NX.hpp"
+#include "reference/Polynomials_A380X.hpp"
+
+// Compares the engine model polynomials in Horner form with the previous implementation that summed the powers of the
+// inputs, over the ranges in which the engine control evaluates them.
+
+// Differences are relative to the magnitude of the value, or absolute for values below 1. The high-order start-up
+// polynomials differ by up to 1e-9 from the rounding of the terms.
+static constexpr double Tolerance = 1e-8;
+
+static int failures = 0;
+
+/**
+ * @brief Tracks the largest difference between the current and the reference implementation of a polynomial
+ */
+class Comparison {
+ public:
+  Comparison(std::string name) : _name(std::move(name)) {}
+
+  void add(double current, double reference) {
+    const double difference = std::fabs(current - reference) / (std::max)(1.0, std::fabs(reference));
+    _maxDifference = (std::max)(_maxDifference, std::isnan(difference) ? INFINITY : difference);
+    _samples += 1;
+  }
+
+  ~Comparison() {
+    const bool passed = _samples > 0 && _maxDifference <= Tolerance;
+    std::cout << (passed ? "PASS: " : "FAIL: ") << _name << " (" << _samples << " samples, max difference " << _maxDifference << ")"
+              << std::endl;
+    if (!passed) {
+      failures += 1;
+    }
+  }
+
+ private:
+  std::string _name;
+  double _maxDifference = 0;
+  long _samples = 0;
+};
+
+/**
+ * @brief Calls the function for the values from start to end in the given number of steps
+ */
+static void sweep(double start, double end, int steps, const std::function<void(double)>& function) {
+  for (int i = 0; i <= steps; ++i) {
+    function(start + (end - start) * i / steps);
+  }
+}
+
+static std::string label(const std::string& name, double idle) {
+  std::ostringstream stream;
+  stream << name << " at idle " << idle;
+  return stream.str();
+}
+
+template <class Current, class Reference>
+static void compareCorrectedPolynomials(const std::string& aircraft) {
+  {
+    Comparison comparison(aircraft + " corrected EGT");
+    sweep(0, 110, 110, [&](double cn1) {
+      sweep(0, 8000, 40, [&](double cff) {
+        sweep(0, 0.9, 9, [&](double mach) {
+          sweep(0, 45000, 45, [&](double alt) {
+            comparison.add(Current::correctedEGT(cn1, cff, mach, alt), Reference::correctedEGT(cn1, cff, mach, alt));
+          });
+        });
+      });
+    });
+  }
+  {
+    Comparison comparison(aircraft + " corrected fuel flow");
+    sweep(0, 110, 440, [&](double cn1) {
+      sweep(0, 0.9, 18, [&](double mach) {
+        sweep(0, 45000, 90, [&](double alt) {
+          comparison.add(Current::correctedFuelFlow(cn1, mach, alt), Reference::correctedFuelFlow(cn1, mach, alt));
+        });
+      });
+    });
+  }
+  {
+    Comparison comparison(aircraft + " oil gulp");
+    sweep(0, 35000, 3500, [&](double thrust) { comparison.add(Current::oilGulpPct(thrust), Reference::oilGulpPct(thrust)); });
+  }
+  {
+    Comparison comparison(aircraft + " oil pressure");
+    sweep(0, 110, 1100, [&](double n) { comparison.add(Current::oilPressure(n), Reference::oilPressure(n)); });
+  }
+}
+
+int main() {
+  // start-up from standstill to idle, the previous value is the one of the last frame
+  for (const double idleN2 : {60.0, 68.2, 72.0}) {
+    const double idleN1 = 19.0;
+    const double idleFF = 300.0;
+    const double idleEGT = 400.0;
+    Comparison n2(label("A32NX start N2", idleN2));
+    Comparison n1(label("A32NX start N1", idleN2));
+    Comparison ff(label("A32NX start FF", idleN2));
+    Comparison egt(label("A32NX start EGT", idleN2));
+    sweep(0, idleN2, 10000, [&](double n) {
+      n2.add(Polynomial_A32NX::startN2(n, n - 0.01, idleN2), reference::Polynomial_A32NX::startN2(n, n - 0.01, idleN2));
+      n1.add(Polynomial_A32NX::startN1(n, idleN2, idleN1), reference::Polynomial_A32NX::startN1(n, idleN2, idleN1));
+      ff.add(Polynomial_A32NX::startFF(n, idleN2, idleFF), reference::Polynomial_A32NX::startFF(n, idleN2, idleFF));
+      sweep(-50, 50, 10, [&](double ambientTemp) {
+        egt.add(Polynomial_A32NX::startEGT(n, idleN2, ambientTemp, idleEGT),
+                reference::Polynomial_A32NX::startEGT(n, idleN2, ambientTemp, idleEGT));
+      });
+    });
+  }
+
+  for (const double idleN3 : {60.0, 68.0, 72.0}) {
+    const double idleN1 = 18.0;
+    const double idleFF = 600.0;
+    const double idleEGT = 420.0;
+    Comparison n3(label("A380X start N3", idleN3));
+    Comparison n1(label("A380X start N1", idleN3));
+    Comparison ff(label("A380X start FF", idleN3));
+    Comparison egt(label("A380X start EGT", idleN3));
+    sweep(0, idleN3, 10000, [&](double n) {
+      n3.add(Polynomial_A380X::startN3(n, n - 0.01, idleN3), reference::Polynomial_A380X::startN3(n, n - 0.01, idleN3));
+      n1.add(Polynomial_A380X::startN1(n, idleN3, idleN1), reference::Polynomial_A380X::startN1(n, idleN3, idleN1));
+      ff.add(Polynomial_A380X::startFF(n, idleN3, idleFF), reference::Polynomial_A380X::startFF(n, idleN3, idleFF));
+      sweep(-50, 50, 10, [&](double ambientTemp) {
+        egt.add(Polynomial_A380X::startEGT(n, idleN3, ambientTemp, idleEGT),
+                reference::Polynomial_A380X::startEGT(n, idleN3, ambientTemp, idleEGT));
+      });
+    });
+  }
+
+  compareCorrectedPolynomials<Polynomial_A32NX, reference::Polynomial_A32NX>("A32NX");
+  compareCorrectedPolynomials<Polynomial_A380X, reference::Polynomial_A380X>("A380X");
+
+  std::cout << (failures == 0 ? "All checks passed" : std::to_string(failures) + " checks failed") << std::endl;
+  return failures == 0 ? 0 : 1;
+}
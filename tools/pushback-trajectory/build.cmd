@@ -0,0 +1,19 @@
+@echo off
+
+:: go to current directory
+pushd %~dp0
+
+:: clean build directory
+rd /s /q build
+
+:: create build files
+cmake -B build
+
+:: build
+cmake --build build --config Release
+
+:: compare the trajectories
+ctest --test-dir build --build-config Release --output-on-failure
+
+:: restore directory
+popd
@@ -0,0 +1,80 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <cmath>
+#include <cstdio>
+#include <initializer_list>
+
+#include "PushbackIntegrator.hpp"
+
+// Drives the PushbackIntegrator like the Pushback module does at different frame rates and moves the aircraft with
+// the resulting speed and rotation velocity like the simulator does. The final position and heading must not depend
+// on the frame rate.
+
+struct Trajectory {
+  double x;        // ft
+  double y;        // ft
+  double heading;  // rad
+};
+
+// the tug command of the scenario at the given simulation time
+// The command changes at multiples of 2/3 s, which are frame times at all tested frame and simulation rates, so
+// that the command sequence does not depend on the frame rate.
+static void command(double time, double& targetSpeed, double& rotationPerSpeed) {
+  // rounding errors of the frame times must not move a change to the next frame
+  time += 1e-9;
+  // standing, pushing straight back, pushing back in a turn, stopping
+  targetSpeed = time < 2.0 ? 0.0 : time < 24.0 ? -4.0 : 0.0;
+  rotationPerSpeed = time >= 8.0 && time < 20.0 ? 0.015 : 0.0;
+}
+
+static Trajectory simulate(double framesPerSecond, double duration, double simulationRate) {
+  PushbackIntegrator integrator;
+  Trajectory trajectory{};
+  const int frames = static_cast<int>(std::lround(duration * framesPerSecond));
+  const double deltaTime = simulationRate / framesPerSecond;
+
+  for (int frame = 0; frame < frames; ++frame) {
+    double targetSpeed = 0.0;
+    double rotationPerSpeed = 0.0;
+    command(frame * deltaTime, targetSpeed, rotationPerSpeed);
+
+    const PushbackState state = integrator.update(deltaTime, targetSpeed, rotationPerSpeed);
+
+    // the simulator applies the body velocities until the next frame
+    trajectory.heading += state.rotationVelocity * deltaTime;
+    trajectory.x += state.speed * deltaTime * std::sin(trajectory.heading);
+    trajectory.y += state.speed * deltaTime * std::cos(trajectory.heading);
+  }
+
+  return trajectory;
+}
+
+int main() {
+  // 60 s of simulation time are a multiple of every frame time
+  constexpr double Duration = 60.0;
+  // tolerances for the quantization of the command changes and the interpolation to the frame times
+  constexpr double PositionTolerance = 0.25;  // ft
+  constexpr double HeadingTolerance = 0.001;  // rad
+
+  int failures = 0;
+  for (const double simulationRate : {1.0, 4.0}) {
+    const Trajectory reference = simulate(60.0, Duration / simulationRate, simulationRate);
+    std::printf("rate %.0fx  60 fps: x %9.3f ft  y %9.3f ft  heading %8.5f rad\n", simulationRate, reference.x, reference.y,
+                reference.heading);
+
+    for (const double framesPerSecond : {30.0, 144.0}) {
+      const Trajectory trajectory = simulate(framesPerSecond, Duration / simulationRate, simulationRate);
+      const double positionError = std::hypot(trajectory.x - reference.x, trajectory.y - reference.y);
+      const double headingError = std::fabs(trajectory.heading - reference.heading);
+      const bool passed = positionError <= PositionTolerance && headingError <= HeadingTolerance;
+      failures += passed ? 0 : 1;
+
+      std::printf("rate %.0fx %3.0f fps: x %9.3f ft  y %9.3f ft  heading %8.5f rad  position error %.4f ft  heading error %.6f rad  %s\n",
+                  simulationRate, framesPerSecond, trajectory.x, trajectory.y, trajectory.heading, positionError, headingError,
+                  passed ? "PASS" : "FAIL");
+    }
+  }
+
+  return failures == 0 ? 0 : 1;
+}
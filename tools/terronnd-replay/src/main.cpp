@@ -0,0 +1,264 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "navigationdisplay/display.h"
+#include "simulator.h"
+
+// Replays SimBridge transfers through the terronnd client data areas, chunk reassembly, frame decoder and image upload
+// and compares the displayed pixels with the source frames.
+
+using FrameReassembler = ChunkReassembler<std::uint8_t, SIMCONNECT_CLIENTDATA_MAX_SIZE>;
+
+static constexpr std::uint16_t FrameWidth = 200;
+static constexpr std::uint16_t FrameHeight = 150;
+static constexpr std::uint16_t DisplayRange = 10;
+
+static int failures = 0;
+
+static void check(bool condition, const std::string& message) {
+  std::cout << (condition ? "PASS: " : "FAIL: ") << message << std::endl;
+  if (!condition) {
+    failures += 1;
+  }
+}
+
+/**
+ * @brief Gives access to the image of the display
+ */
+class ReplayDisplay : public navigationdisplay::DisplayLeft {
+ public:
+  ReplayDisplay(simconnect::Connection& connection) : navigationdisplay::DisplayLeft(connection, nullptr) {}
+
+  int image() const { return this->_nanovgImage; }
+};
+
+/**
+ * @brief A palette-indexed terrain frame and the pixels that the display has to show for it
+ */
+struct Frame {
+  std::vector<std::uint32_t> palette;
+  std::vector<std::uint8_t> indices;
+
+  std::vector<unsigned char> rgba() const {
+    std::vector<unsigned char> pixels(this->indices.size() * 4);
+    for (std::size_t i = 0; i < this->indices.size(); ++i) {
+      std::memcpy(&pixels[i * 4], &this->palette[this->indices[i]], 4);
+    }
+    return pixels;
+  }
+};
+
+static Frame createFrame(std::uint32_t seed) {
+  Frame frame{{0x00000000, 0xff00ff00, 0xff007fff, 0xff0000ff, 0xff3f3f3f}, {}};
+  frame.indices.resize(static_cast<std::size_t>(FrameWidth) * FrameHeight);
+  for (std::size_t y = 0; y < FrameHeight; ++y) {
+    for (std::size_t x = 0; x < FrameWidth; ++x) {
+      // bands with some noise, so that there are long and short runs
+      const std::size_t band = (x / 7 + y / 5 + seed) % frame.palette.size();
+      frame.indices[y * FrameWidth + x] = static_cast<std::uint8_t>((x * y + seed) % 11 == 0 ? (band + 1) % frame.palette.size() : band);
+    }
+  }
+  return frame;
+}
+
+static std::vector<std::uint8_t> encodeHeader(const Frame& frame, std::uint8_t format, std::uint32_t sequence) {
+  const types::FrameHeader header{types::FrameHeaderMagic, format, FrameWidth, FrameHeight,
+                                  static_cast<std::uint16_t>(frame.palette.size()), sequence};
+  std::vector<std::uint8_t> data(sizeof(header) + frame.palette.size() * sizeof(std::uint32_t));
+  std::memcpy(data.data(), &header, sizeof(header));
+  std::memcpy(data.data() + sizeof(header), frame.palette.data(), frame.palette.size() * sizeof(std::uint32_t));
+  return data;
+}
+
+static void encodeRunLength(const Frame& frame, const types::FrameRegion& region, std::vector<std::uint8_t>& data) {
+  std::vector<std::uint8_t> pixels;
+  for (std::size_t y = region.y; y < static_cast<std::size_t>(region.y) + region.height; ++y) {
+    const auto row = frame.indices.begin() + static_cast<std::ptrdiff_t>(y * FrameWidth + region.x);
+    pixels.insert(pixels.end(), row, row + region.width);
+  }
+
+  for (std::size_t i = 0; i < pixels.size();) {
+    std::size_t runLength = 1;
+    while (i + runLength < pixels.size() && runLength < 256 && pixels[i + runLength] == pixels[i]) {
+      runLength += 1;
+    }
+    data.push_back(static_cast<std::uint8_t>(runLength - 1));
+    data.push_back(pixels[i]);
+    i += runLength;
+  }
+}
+
+static std::vector<std::uint8_t> encodeRaw(const Frame& frame, std::uint32_t sequence) {
+  auto data = encodeHeader(frame, types::FrameFormat::RAW_INDEXED, sequence);
+  data.insert(data.end(), frame.indices.begin(), frame.indices.end());
+  return data;
+}
+
+static std::vector<std::uint8_t> encodeRunLength(const Frame& frame, std::uint32_t sequence) {
+  auto data = encodeHeader(frame, types::FrameFormat::RUN_LENGTH_INDEXED, sequence);
+  encodeRunLength(frame, types::FrameRegion{0, 0, FrameWidth, FrameHeight}, data);
+  return data;
+}
+
+static std::vector<std::uint8_t> encodeDelta(const Frame& frame, const std::vector<types::FrameRegion>& regions, std::uint32_t sequence) {
+  auto data = encodeHeader(frame, types::FrameFormat::RUN_LENGTH_INDEXED_DELTA, sequence);
+  const std::uint16_t regionCount = static_cast<std::uint16_t>(regions.size());
+  const auto count = reinterpret_cast<const std::uint8_t*>(&regionCount);
+  data.insert(data.end(), count, count + sizeof(regionCount));
+  for (const auto& region : regions) {
+    const auto bytes = reinterpret_cast<const std::uint8_t*>(&region);
+    data.insert(data.end(), bytes, bytes + sizeof(region));
+  }
+  for (const auto& region : regions) {
+    encodeRunLength(frame, region, data);
+  }
+  return data;
+}
+
+static std::vector<std::uint8_t> encodePng(std::uint32_t width, std::uint32_t height) {
+  std::vector<std::uint8_t> data = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n', 0, 0, 0, 13, 'I', 'H', 'D', 'R'};
+  for (const std::uint32_t value : {width, height}) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      data.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+  }
+  data.resize(data.size() + 64, 0);
+  return data;
+}
+
+/**
+ * @brief Sends a frame like the SimBridge: the threshold data announces the size, then the chunks follow
+ * @param connection The connection of the display
+ * @param frame The frame data
+ * @param withHeaders True if the chunks start with a ChunkHeader
+ * @param transferSequence The sequence number of the transfer in the chunk headers
+ * @param lostChunk The index of a chunk that is not delivered, or a negative value if all chunks are delivered
+ */
+static void sendFrame(simconnect::Connection& connection,
+                      const std::vector<std::uint8_t>& frame,
+                      bool withHeaders,
+                      std::uint32_t transferSequence = 0,
+                      int lostChunk = -1) {
+  types::ThresholdData thresholds{};
+  thresholds.lowerThreshold = 1000;
+  thresholds.upperThreshold = 5000;
+  thresholds.firstFrame = 1;
+  thresholds.displayRange = DisplayRange;
+  thresholds.displayMode = navigationdisplay::NavigationDisplayArcModeId;
+  thresholds.frameByteCount = static_cast<std::uint32_t>(frame.size());
+  simulator::sendClientData(navigationdisplay::ThresholdsLeftName, &thresholds, sizeof(thresholds));
+
+  std::vector<std::uint8_t> chunk(SIMCONNECT_CLIENTDATA_MAX_SIZE);
+  std::size_t offset = 0;
+  for (int index = 0; offset < frame.size(); ++index) {
+    std::size_t size = 0;
+    if (withHeaders) {
+      size = FrameReassembler::fillChunk(chunk.data(), frame.data(), frame.size(), transferSequence, offset);
+    } else {
+      size = std::min(frame.size() - offset, chunk.size());
+      std::fill(chunk.begin(), chunk.end(), 0);
+      std::memcpy(chunk.data(), frame.data() + offset, size);
+    }
+    offset += size;
+
+    if (index != lostChunk) {
+      simulator::sendClientData(navigationdisplay::FrameDataLeftName, chunk.data(), chunk.size());
+    }
+  }
+
+  connection.readData();
+}
+
+static bool displays(const ReplayDisplay& display, const Frame& frame) {
+  const simulator::Image* image = simulator::image(display.image());
+  return image != nullptr && !image->encoded && image->width == FrameWidth && image->height == FrameHeight &&
+         image->pixels == frame.rgba();
+}
+
+int main() {
+  simconnect::Connection connection;
+  check(connection.connect("terronnd-replay"), "connection established");
+
+  ReplayDisplay display(connection);
+  navigationdisplay::DisplayBase::NdConfiguration configuration{};
+  configuration.range = static_cast<float>(DisplayRange) * types::nauticmile;
+  configuration.mode = navigationdisplay::NavigationDisplayArcModeId;
+  configuration.terrainActive = true;
+  configuration.potentiometer = 1.0f;
+  configuration.powered = true;
+  display.update(configuration);
+
+  // raw indexed frame in chunks without headers
+  Frame frame = createFrame(0);
+  sendFrame(connection, encodeRaw(frame, 1), false);
+  check(displays(display, frame), "raw indexed frame is displayed");
+  check(display.frameSequence() == 1, "raw indexed frame is the base for delta frames");
+
+  // run-length frame of the same size in chunks with headers is uploaded into the existing image
+  const int image = display.image();
+  const std::size_t updates = simulator::imageUpdates();
+  frame = createFrame(1);
+  sendFrame(connection, encodeRunLength(frame, 2), true, 1);
+  check(displays(display, frame), "run-length frame is displayed");
+  check(display.image() == image && simulator::imageUpdates() == updates + 1, "run-length frame is uploaded into the existing image");
+
+  // delta frame patches the changed regions
+  Frame changed = createFrame(2);
+  const std::vector<types::FrameRegion> regions = {{10, 20, 50, 30}, {120, 0, 80, 150}};
+  sendFrame(connection, encodeDelta(changed, regions, 3), true, 2);
+  for (const auto& region : regions) {
+    for (std::size_t y = region.y; y < static_cast<std::size_t>(region.y) + region.height; ++y) {
+      std::copy_n(&changed.indices[y * FrameWidth + region.x], region.width, &frame.indices[y * FrameWidth + region.x]);
+    }
+  }
+  check(displays(display, frame), "delta frame is patched into the displayed frame");
+  check(display.frameSequence() == 3, "delta frame is the base for the next delta frame");
+
+  // delta frame that does not follow the displayed frame is ignored
+  sendFrame(connection, encodeDelta(createFrame(3), regions, 5), true, 3);
+  check(displays(display, frame), "out of sequence delta frame keeps the displayed frame");
+  check(display.frameSequence() == 3, "out of sequence delta frame keeps the sequence");
+
+  // a transfer with a lost chunk is dropped instead of being displayed
+  sendFrame(connection, encodeRaw(createFrame(4), 6), true, 4, 1);
+  check(displays(display, frame), "transfer with a lost chunk keeps the displayed frame");
+
+  // the next complete transfer is displayed again
+  frame = createFrame(5);
+  sendFrame(connection, encodeRaw(frame, 7), true, 5);
+  check(displays(display, frame), "complete transfer after a dropped transfer is displayed");
+
+  // encoded images are handed to nanovg
+  sendFrame(connection, encodePng(768, 492), false);
+  const simulator::Image* encoded = simulator::image(display.image());
+  check(encoded != nullptr && encoded->encoded && encoded->width == 768 && encoded->height == 492, "encoded image is displayed");
+  check(display.frameSequence() == 0, "encoded image is not a base for delta frames");
+
+  // delta frame on top of an encoded image is ignored
+  sendFrame(connection, encodeDelta(createFrame(6), regions, 8), true, 6);
+  check(display.image() != 0 && simulator::image(display.image())->encoded, "delta frame after an encoded image keeps the image");
+
+  // frames that are neither indexed nor an image are not displayed
+  std::vector<std::uint8_t> garbage(5000, 0x5a);
+  sendFrame(connection, garbage, false);
+  check(display.image() == 0, "frame that is neither indexed nor an image is not displayed");
+
+  // corrupt indexed frame is not displayed
+  std::vector<std::uint8_t> truncated = encodeRaw(createFrame(7), 9);
+  truncated.resize(truncated.size() / 2);
+  sendFrame(connection, truncated, true, 7);
+  check(display.image() == 0 && display.frameSequence() == 0, "truncated indexed frame is not displayed");
+
+  display.destroy();
+  check(simulator::imageCount() == 0, "all images are released");
+
+  std::cout << (failures == 0 ? "All checks passed" : std::to_string(failures) + " checks failed") << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <MSFS/Legacy/gauges.h>
+#include <MSFS/Render/nanovg.h>
+#include <SimConnect.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "simulator.h"
+
+namespace {
+
+struct ClientDataArea {
+  DWORD definitionId;
+  DWORD requestId;
+  bool requested;
+};
+
+std::map<std::string, DWORD> clientDataIds;
+std::map<DWORD, ClientDataArea> clientDataAreas;
+std::map<DWORD, DWORD> clientDataDefinitionSizes;
+std::deque<std::vector<std::uint8_t>> messages;
+std::vector<std::uint8_t> dispatchedMessage;
+
+std::vector<double> namedVariables;
+
+std::map<int, simulator::Image> images;
+int nextImageHandle = 1;
+std::size_t imageUpdateCount = 0;
+
+int connectionHandle = 0;
+
+constexpr std::uint8_t PngSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+
+int readBigEndian(const unsigned char* data) {
+  return (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+}
+
+}  // namespace
+
+bool simulator::sendClientData(const std::string& name, const void* data, std::size_t size) {
+  auto id = clientDataIds.find(name);
+  if (id == clientDataIds.end()) {
+    return false;
+  }
+  auto area = clientDataAreas.find(id->second);
+  if (area == clientDataAreas.end() || !area->second.requested) {
+    return false;
+  }
+  const std::size_t areaSize = clientDataDefinitionSizes[area->second.definitionId];
+  if (size > areaSize) {
+    return false;
+  }
+
+  // the data starts at dwData and replaces it
+  const std::size_t headerSize = sizeof(SIMCONNECT_RECV_CLIENT_DATA) - sizeof(DWORD);
+  std::vector<std::uint8_t> message(headerSize + areaSize, 0);
+  SIMCONNECT_RECV_CLIENT_DATA header{};
+  header.dwSize = static_cast<DWORD>(message.size());
+  header.dwID = SIMCONNECT_RECV_ID_CLIENT_DATA;
+  header.dwRequestID = area->second.requestId;
+  header.dwDefineID = area->second.definitionId;
+  std::memcpy(message.data(), &header, headerSize);
+  std::memcpy(message.data() + headerSize, data, size);
+  messages.push_back(std::move(message));
+  return true;
+}
+
+const simulator::Image* simulator::image(int handle) {
+  auto image = images.find(handle);
+  return image != images.end() ? &image->second : nullptr;
+}
+
+std::size_t simulator::imageCount() {
+  return images.size();
+}
+
+std::size_t simulator::imageUpdates() {
+  return imageUpdateCount;
+}
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char*, void*, DWORD, HANDLE, DWORD) {
+  *phSimConnect = &connectionHandle;
+  return S_OK;
+}
+
+HRESULT SimConnect_Close(HANDLE) {
+  return S_OK;
+}
+
+HRESULT SimConnect_GetNextDispatch(HANDLE, SIMCONNECT_RECV** ppData, DWORD* pcbData) {
+  if (messages.empty()) {
+    return E_FAIL;
+  }
+
+  dispatchedMessage = std::move(messages.front());
+  messages.pop_front();
+  *ppData = reinterpret_cast<SIMCONNECT_RECV*>(dispatchedMessage.data());
+  *pcbData = static_cast<DWORD>(dispatchedMessage.size());
+  return S_OK;
+}
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE, DWORD, const char*, const char*, SIMCONNECT_DATATYPE, float, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE, DWORD, DWORD, DWORD, SIMCONNECT_PERIOD, DWORD, DWORD, DWORD, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE, const char* szClientDataName, DWORD ClientDataID) {
+  clientDataIds[szClientDataName] = ClientDataID;
+  return S_OK;
+}
+
+HRESULT SimConnect_CreateClientData(HANDLE, DWORD, DWORD, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE, DWORD DefineID, DWORD, DWORD dwSizeOrType, float, DWORD) {
+  clientDataDefinitionSizes[DefineID] += dwSizeOrType;
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestClientData(HANDLE, DWORD ClientDataID, DWORD RequestID, DWORD DefineID, SIMCONNECT_CLIENT_DATA_PERIOD, DWORD, DWORD, DWORD, DWORD) {
+  clientDataAreas[ClientDataID] = ClientDataArea{DefineID, RequestID, true};
+  return S_OK;
+}
+
+HRESULT SimConnect_SetClientData(HANDLE, DWORD, DWORD, DWORD, DWORD, DWORD, void*) {
+  return S_OK;
+}
+
+ID register_named_variable(PCSTRINGZ) {
+  namedVariables.push_back(0.0);
+  return static_cast<ID>(namedVariables.size() - 1);
+}
+
+FLOAT64 get_named_variable_value(ID id) {
+  return namedVariables[static_cast<std::size_t>(id)];
+}
+
+void set_named_variable_value(ID id, FLOAT64 value) {
+  namedVariables[static_cast<std::size_t>(id)] = value;
+}
+
+struct NVGcontext {
+  void* userPtr;
+};
+
+NVGcontext* nvgCreateInternal(NVGparams* params) {
+  return new NVGcontext{params->userPtr};
+}
+
+void nvgDeleteInternal(NVGcontext* ctx) {
+  delete ctx;
+}
+
+// only the size of a PNG image is read from its header, the pixels are not decoded
+int nvgCreateImageMem(NVGcontext*, int, unsigned char* data, int ndata) {
+  if (ndata < 24 || std::memcmp(data, PngSignature, sizeof(PngSignature)) != 0 || std::memcmp(data + 12, "IHDR", 4) != 0) {
+    return 0;
+  }
+
+  const int handle = nextImageHandle++;
+  images[handle] = simulator::Image{readBigEndian(data + 16), readBigEndian(data + 20), true, {}};
+  return handle;
+}
+
+int nvgCreateImageRGBA(NVGcontext*, int w, int h, int, const unsigned char* data) {
+  const int handle = nextImageHandle++;
+  images[handle] = simulator::Image{w, h, false, std::vector<unsigned char>(data, data + static_cast<std::size_t>(w) * h * 4)};
+  return handle;
+}
+
+void nvgUpdateImage(NVGcontext*, int image, const unsigned char* data) {
+  auto& entry = images.at(image);
+  std::memcpy(entry.pixels.data(), data, entry.pixels.size());
+  imageUpdateCount += 1;
+}
+
+void nvgDeleteImage(NVGcontext*, int image) {
+  images.erase(image);
+}
+
+void nvgBeginFrame(NVGcontext*, float, float, float) {}
+
+void nvgEndFrame(NVGcontext*) {}
+
+NVGcolor nvgRGBA(unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+  return NVGcolor{r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
+}
+
+void nvgFillColor(NVGcontext*, NVGcolor) {}
+
+void nvgFillPaint(NVGcontext*, NVGpaint) {}
+
+NVGpaint nvgImagePattern(NVGcontext*, float, float, float, float, float, int image, float) {
+  NVGpaint paint{};
+  paint.image = image;
+  return paint;
+}
+
+void nvgBeginPath(NVGcontext*) {}
+
+void nvgRect(NVGcontext*, float, float, float, float) {}
+
+void nvgFill(NVGcontext*) {}
@@ -0,0 +1,52 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Replaces the simulator for the replay
+ *
+ * The SimConnect, gauge and nanovg functions that are used by terronnd are implemented on top of this state.
+ * Client data that is sent to an area is queued as a SimConnect message and delivered by the next
+ * simconnect::Connection::readData() call, images are kept in memory so that their pixels can be checked.
+ */
+namespace simulator {
+
+struct Image {
+  int width;
+  int height;
+  bool encoded;
+  std::vector<unsigned char> pixels;
+};
+
+/**
+ * @brief Queues client data for the area that is mapped to the name
+ * @param name The name of the client data area
+ * @param data The data that is sent
+ * @param size The number of bytes, the remaining bytes of the defined area size are zero
+ * @return true if the area is requested by terronnd and the data is queued
+ */
+bool sendClientData(const std::string& name, const void* data, std::size_t size);
+
+/**
+ * @brief Returns an image that was created by nanovg
+ * @param handle The nanovg image handle
+ * @return const Image* The image or nullptr if the handle is unknown
+ */
+const Image* image(int handle);
+
+/**
+ * @brief Returns the number of images that are alive
+ */
+std::size_t imageCount();
+
+/**
+ * @brief Returns the number of uploads into existing images
+ */
+std::size_t imageUpdates();
+
+}  // namespace simulator
@@ -0,0 +1,26 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Subset of the gauge API that is used by terronnd, implemented by the replay in simulator.cpp
+
+#pragma once
+
+typedef void* FsContext;
+typedef int ID;
+typedef double FLOAT64;
+typedef const char* PCSTRINGZ;
+
+struct sGaugeDrawData {
+  double mx;
+  double my;
+  double t;
+  double dt;
+  int winWidth;
+  int winHeight;
+  int fbWidth;
+  int fbHeight;
+};
+
+ID register_named_variable(PCSTRINGZ name);
+FLOAT64 get_named_variable_value(ID id);
+void set_named_variable_value(ID id, FLOAT64 value);
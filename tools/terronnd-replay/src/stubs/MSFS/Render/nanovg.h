@@ -0,0 +1,47 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Subset of the nanovg API that is used by terronnd, implemented by the replay in simulator.cpp
+
+#pragma once
+
+#include "../Legacy/gauges.h"
+
+struct NVGcontext;
+
+struct NVGcolor {
+  float r, g, b, a;
+};
+
+struct NVGpaint {
+  float xform[6];
+  float extent[2];
+  float radius;
+  float feather;
+  NVGcolor innerColor;
+  NVGcolor outerColor;
+  int image;
+};
+
+struct NVGparams {
+  void* userPtr;
+  int edgeAntiAlias;
+};
+
+NVGcontext* nvgCreateInternal(NVGparams* params);
+void nvgDeleteInternal(NVGcontext* ctx);
+
+int nvgCreateImageMem(NVGcontext* ctx, int imageFlags, unsigned char* data, int ndata);
+int nvgCreateImageRGBA(NVGcontext* ctx, int w, int h, int imageFlags, const unsigned char* data);
+void nvgUpdateImage(NVGcontext* ctx, int image, const unsigned char* data);
+void nvgDeleteImage(NVGcontext* ctx, int image);
+
+void nvgBeginFrame(NVGcontext* ctx, float windowWidth, float windowHeight, float devicePixelRatio);
+void nvgEndFrame(NVGcontext* ctx);
+NVGcolor nvgRGBA(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+void nvgFillColor(NVGcontext* ctx, NVGcolor color);
+void nvgFillPaint(NVGcontext* ctx, NVGpaint paint);
+NVGpaint nvgImagePattern(NVGcontext* ctx, float ox, float oy, float ex, float ey, float angle, int image, float alpha);
+void nvgBeginPath(NVGcontext* ctx);
+void nvgRect(NVGcontext* ctx, float x, float y, float w, float h);
+void nvgFill(NVGcontext* ctx);
@@ -0,0 +1,124 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Subset of the SimConnect API that is used by terronnd, implemented by the replay in simulator.cpp
+
+#pragma once
+
+#include <cstdint>
+
+typedef std::uint32_t DWORD;
+typedef void* HANDLE;
+typedef std::int32_t HRESULT;
+
+#define S_OK ((HRESULT)0)
+#define E_FAIL ((HRESULT)0x80004005)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+
+#define SIMCONNECT_CLIENTDATA_MAX_SIZE 8192
+#define SIMCONNECT_CLIENTDATAOFFSET_AUTO ((DWORD)-1)
+#define SIMCONNECT_UNUSED ((DWORD)-1)
+#define SIMCONNECT_OBJECT_ID_USER 0
+
+#define SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT 0x00000000
+#define SIMCONNECT_CREATE_CLIENT_DATA_FLAG_READ_ONLY 0x00000001
+#define SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_DEFAULT 0x00000000
+#define SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT 0x00000000
+#define SIMCONNECT_DATA_REQUEST_FLAG_DEFAULT 0x00000000
+#define SIMCONNECT_DATA_REQUEST_FLAG_CHANGED 0x00000001
+
+enum SIMCONNECT_RECV_ID {
+  SIMCONNECT_RECV_ID_NULL,
+  SIMCONNECT_RECV_ID_EXCEPTION,
+  SIMCONNECT_RECV_ID_OPEN,
+  SIMCONNECT_RECV_ID_QUIT,
+  SIMCONNECT_RECV_ID_SIMOBJECT_DATA = 8,
+  SIMCONNECT_RECV_ID_CLIENT_DATA = 16,
+};
+
+enum SIMCONNECT_DATATYPE {
+  SIMCONNECT_DATATYPE_INVALID,
+  SIMCONNECT_DATATYPE_INT32,
+  SIMCONNECT_DATATYPE_INT64,
+  SIMCONNECT_DATATYPE_FLOAT32,
+  SIMCONNECT_DATATYPE_FLOAT64,
+};
+
+enum SIMCONNECT_PERIOD {
+  SIMCONNECT_PERIOD_NEVER,
+  SIMCONNECT_PERIOD_ONCE,
+  SIMCONNECT_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_PERIOD_SIM_FRAME,
+  SIMCONNECT_PERIOD_SECOND,
+};
+
+enum SIMCONNECT_CLIENT_DATA_PERIOD {
+  SIMCONNECT_CLIENT_DATA_PERIOD_NEVER,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+  SIMCONNECT_CLIENT_DATA_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET,
+  SIMCONNECT_CLIENT_DATA_PERIOD_SECOND,
+};
+
+struct SIMCONNECT_RECV {
+  DWORD dwSize;
+  DWORD dwVersion;
+  DWORD dwID;
+};
+
+struct SIMCONNECT_RECV_EXCEPTION : public SIMCONNECT_RECV {
+  DWORD dwException;
+  DWORD dwSendID;
+  DWORD dwIndex;
+};
+
+struct SIMCONNECT_RECV_SIMOBJECT_DATA : public SIMCONNECT_RECV {
+  DWORD dwRequestID;
+  DWORD dwObjectID;
+  DWORD dwDefineID;
+  DWORD dwFlags;
+  DWORD dwentrynumber;
+  DWORD dwoutof;
+  DWORD dwDefineCount;
+  DWORD dwData;
+};
+
+struct SIMCONNECT_RECV_CLIENT_DATA : public SIMCONNECT_RECV_SIMOBJECT_DATA {};
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char* szName, void* hWnd, DWORD UserEventWin32, HANDLE hEventHandle, DWORD ConfigIndex);
+HRESULT SimConnect_Close(HANDLE hSimConnect);
+HRESULT SimConnect_GetNextDispatch(HANDLE hSimConnect, SIMCONNECT_RECV** ppData, DWORD* pcbData);
+HRESULT SimConnect_AddToDataDefinition(HANDLE hSimConnect,
+                                       DWORD DefineID,
+                                       const char* DatumName,
+                                       const char* UnitsName,
+                                       SIMCONNECT_DATATYPE DatumType = SIMCONNECT_DATATYPE_FLOAT64,
+                                       float fEpsilon = 0,
+                                       DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE hSimConnect,
+                                          DWORD RequestID,
+                                          DWORD DefineID,
+                                          DWORD ObjectID,
+                                          SIMCONNECT_PERIOD Period,
+                                          DWORD Flags = 0,
+                                          DWORD origin = 0,
+                                          DWORD interval = 0,
+                                          DWORD limit = 0);
+HRESULT SimConnect_MapClientDataNameToID(HANDLE hSimConnect, const char* szClientDataName, DWORD ClientDataID);
+HRESULT SimConnect_CreateClientData(HANDLE hSimConnect, DWORD ClientDataID, DWORD dwSize, DWORD Flags);
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE hSimConnect,
+                                             DWORD DefineID,
+                                             DWORD dwOffset,
+                                             DWORD dwSizeOrType,
+                                             float fEpsilon = 0,
+                                             DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestClientData(HANDLE hSimConnect,
+                                     DWORD ClientDataID,
+                                     DWORD RequestID,
+                                     DWORD DefineID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD Period = SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+                                     DWORD Flags = 0,
+                                     DWORD origin = 0,
+                                     DWORD interval = 0,
+                                     DWORD limit = 0);
+HRESULT SimConnect_SetClientData(HANDLE hSimConnect, DWORD ClientDataID, DWORD DefineID, DWORD Flags, DWORD dwReserved, DWORD cbUnitSize, void* pDataSet);